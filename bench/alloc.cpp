@@ -0,0 +1,77 @@
+#include "bench.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+
+namespace {
+
+std::atomic<std::size_t> allocationCount{0};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size == 0 ? 1 : size)) {
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
+namespace simple_yaml::bench {
+
+std::size_t allocations() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::size_t peakRssKb() {
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	return static_cast<std::size_t>(usage.ru_maxrss);
+}
+
+std::string generateDocument(std::size_t bytes, std::size_t* recordCount) {
+	std::string out;
+	out.reserve(bytes + 256);
+	out += "version: \"1.0\"\nrecords:\n";
+
+	std::size_t i{0};
+	while (out.size() < bytes) {
+		const auto id = std::to_string(i);
+		out += "  - name: record-" + id + "\n";
+		out += "    host: host" + id + ".example.com\n";
+		out += "    port: " + std::to_string(1024 + i % 60000) + "\n";
+		out += "    weight: " + std::to_string(static_cast<double>(i % 1000) / 7.0) + "\n";
+		out += "    enabled: " + std::string{i % 2 ? "true" : "false"} + "\n";
+		out += "    timeout: " + std::to_string(i % 24) + "h " + std::to_string(i % 60) + "m\n";
+		out += "    tags: [alpha, beta, gamma-" + id + "]\n";
+		++i;
+	}
+	if (recordCount != nullptr) {
+		*recordCount = i;
+	}
+	return out;
+}
+
+} // namespace simple_yaml::bench
@@ -0,0 +1,67 @@
+#ifndef __SIMPLE_YAML_BENCH_HPP__
+#define __SIMPLE_YAML_BENCH_HPP__
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+
+#include "simple-yaml/simple_yaml.hpp"
+
+namespace simple_yaml::bench {
+
+// Number of global operator new calls since the start of the process (see alloc.cpp)
+std::size_t allocations();
+
+// Peak resident set size of the process in kilobytes
+std::size_t peakRssKb();
+
+// Configuration record used by the structured and end-to-end benchmarks
+struct Record : Simple {
+	using Simple::Simple;
+
+	std::string              name    = bound("name");
+	std::string              host    = bound("host");
+	uint16_t                 port    = bound("port");
+	double                   weight  = bound("weight");
+	bool                     enabled = bound("enabled", true);
+	std::chrono::seconds     timeout = bound("timeout");
+	std::vector<std::string> tags    = bound("tags");
+
+	void serialize(Emitter& out) const {
+		out.entry("name", name).entry("host", host).entry("port", port).entry("weight", weight).entry("enabled", enabled);
+		out.entry("timeout", timeout).entry("tags", tags);
+	}
+};
+
+inline constexpr std::size_t recordFields = 7;
+
+struct Inventory : Simple {
+	using Simple::Simple;
+
+	std::string         version = bound("version");
+	std::vector<Record> records = bound("records");
+
+	void serialize(Emitter& out) const {
+		out.entry("version", version).entry("records", records);
+	}
+};
+
+// Returns YAML text of an `Inventory` with as many records as fit into approximately `bytes` bytes
+std::string generateDocument(std::size_t bytes, std::size_t* recordCount = nullptr);
+
+// Reports allocations and peak RSS of the finished benchmark as user counters
+inline void reportCounters(benchmark::State& state, std::size_t allocationsBefore, std::size_t fieldsPerIteration) {
+	const auto allocs = static_cast<double>(allocations() - allocationsBefore) / static_cast<double>(state.iterations());
+
+	state.counters["allocs"]     = allocs;
+	state.counters["peakRssKb"]  = static_cast<double>(peakRssKb());
+	state.counters["fields"]     = benchmark::Counter(static_cast<double>(fieldsPerIteration), benchmark::Counter::kIsIterationInvariantRate);
+	if (fieldsPerIteration != 0) {
+		state.counters["allocs/field"] = allocs / static_cast<double>(fieldsPerIteration);
+	}
+}
+
+} // namespace simple_yaml::bench
+
+#endif // __SIMPLE_YAML_BENCH_HPP__
@@ -0,0 +1,167 @@
+#include "bench.hpp"
+
+#include <array>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+using namespace simple_yaml;
+using namespace simple_yaml::bench;
+
+namespace {
+
+// Deserializes `T` from the same node over and over again
+template<typename T>
+void deserializeNode(benchmark::State& state, const YAML::Node& node, std::size_t fields) {
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<T>::deserialize(node, "/bench"));
+	}
+	reportCounters(state, before, fields);
+}
+
+std::string sequenceOf(std::size_t count, const std::string& element) {
+	std::string out{"["};
+	for (std::size_t i{0}; i < count; ++i) {
+		out += (i == 0 ? "" : ", ") + element;
+	}
+	return out + "]";
+}
+
+std::string mapOf(std::size_t count, const std::string& value) {
+	std::string out;
+	for (std::size_t i{0}; i < count; ++i) {
+		out += "key" + std::to_string(i) + ": " + value + "\n";
+	}
+	return out;
+}
+
+} // namespace
+
+static void BM_Integer(benchmark::State& state) {
+	deserializeNode<int64_t>(state, YAML::Load("1234567890"), 1);
+}
+BENCHMARK(BM_Integer);
+
+static void BM_Double(benchmark::State& state) {
+	deserializeNode<double>(state, YAML::Load("3.14159265358979"), 1);
+}
+BENCHMARK(BM_Double);
+
+static void BM_Bool(benchmark::State& state) {
+	deserializeNode<bool>(state, YAML::Load("true"), 1);
+}
+BENCHMARK(BM_Bool);
+
+#if defined(__has_include) && __has_include(<magic_enum.hpp>)
+
+enum class Level { Trace, Debug, Info, Warning, Error, Critical, Off };
+
+static void BM_Enum(benchmark::State& state) {
+	deserializeNode<Level>(state, YAML::Load("Critical"), 1);
+}
+BENCHMARK(BM_Enum);
+
+enum class Kind {
+	Kind000, Kind001, Kind002, Kind003, Kind004, Kind005, Kind006, Kind007, Kind008, Kind009,
+	Kind010, Kind011, Kind012, Kind013, Kind014, Kind015, Kind016, Kind017, Kind018, Kind019,
+	Kind020, Kind021, Kind022, Kind023, Kind024, Kind025, Kind026, Kind027, Kind028, Kind029,
+	Kind030, Kind031, Kind032, Kind033, Kind034, Kind035, Kind036, Kind037, Kind038, Kind039,
+	Kind040, Kind041, Kind042, Kind043, Kind044, Kind045, Kind046, Kind047, Kind048, Kind049,
+	Kind050, Kind051, Kind052, Kind053, Kind054, Kind055, Kind056, Kind057, Kind058, Kind059,
+	Kind060, Kind061, Kind062, Kind063, Kind064, Kind065, Kind066, Kind067, Kind068, Kind069,
+	Kind070, Kind071, Kind072, Kind073, Kind074, Kind075, Kind076, Kind077, Kind078, Kind079,
+	Kind080, Kind081, Kind082, Kind083, Kind084, Kind085, Kind086, Kind087, Kind088, Kind089,
+	Kind090, Kind091, Kind092, Kind093, Kind094, Kind095, Kind096, Kind097, Kind098, Kind099,
+	Kind100, Kind101, Kind102, Kind103, Kind104, Kind105, Kind106, Kind107, Kind108, Kind109,
+	Kind110, Kind111, Kind112, Kind113, Kind114, Kind115, Kind116, Kind117, Kind118, Kind119,
+};
+
+// Name near the end of a large enum, a linear match compares it with every other name first
+static void BM_EnumLarge(benchmark::State& state) {
+	deserializeNode<Kind>(state, YAML::Load("Kind117"), 1);
+}
+BENCHMARK(BM_EnumLarge);
+
+static void BM_EnumInvalid(benchmark::State& state) {
+	const auto node   = YAML::Load("Kind999");
+	const auto before = allocations();
+	for (auto _ : state) {
+		try {
+			Deserializer<Kind>::deserialize(node, "/bench");
+		} catch (const InvalidNodeType& e) {
+			benchmark::DoNotOptimize(e.what());
+		}
+	}
+	reportCounters(state, before, 1);
+}
+BENCHMARK(BM_EnumInvalid);
+
+#endif
+
+static void BM_DurationPlain(benchmark::State& state) {
+	deserializeNode<std::chrono::milliseconds>(state, YAML::Load("1500"), 1);
+}
+BENCHMARK(BM_DurationPlain);
+
+static void BM_DurationUnits(benchmark::State& state) {
+	deserializeNode<std::chrono::seconds>(state, YAML::Load("1d 2h 30m 10s"), 1);
+}
+BENCHMARK(BM_DurationUnits);
+
+static void BM_String(benchmark::State& state) {
+	deserializeNode<std::string>(state, YAML::Load("host.example.com"), 1);
+}
+BENCHMARK(BM_String);
+
+static void BM_Path(benchmark::State& state) {
+	deserializeNode<std::filesystem::path>(state, YAML::Load("/var/lib/service/data.bin"), 1);
+}
+BENCHMARK(BM_Path);
+
+static void BM_ArrayInt(benchmark::State& state) {
+	deserializeNode<std::array<int, 16>>(state, YAML::Load(sequenceOf(16, "42")), 16);
+}
+BENCHMARK(BM_ArrayInt);
+
+static void BM_VectorInt(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	deserializeNode<std::vector<int>>(state, YAML::Load(sequenceOf(count, "42")), count);
+}
+BENCHMARK(BM_VectorInt)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_VectorDouble(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	deserializeNode<std::vector<double>>(state, YAML::Load(sequenceOf(count, "0.125")), count);
+}
+BENCHMARK(BM_VectorDouble)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_VectorString(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	deserializeNode<std::vector<std::string>>(state, YAML::Load(sequenceOf(count, "/api/v1/resource")), count);
+}
+BENCHMARK(BM_VectorString)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_Map(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	deserializeNode<std::map<std::string, int>>(state, YAML::Load(mapOf(count, "42")), count);
+}
+BENCHMARK(BM_Map)->RangeMultiplier(16)->Range(16, 1 << 14);
+
+static void BM_UnorderedMap(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	deserializeNode<std::unordered_map<std::string, std::string>>(state, YAML::Load(mapOf(count, "value")), count);
+}
+BENCHMARK(BM_UnorderedMap)->RangeMultiplier(16)->Range(16, 1 << 14);
+
+static void BM_VectorStringView(benchmark::State& state) {
+	const auto count    = static_cast<std::size_t>(state.range(0));
+	auto       document = Document::fromString(sequenceOf(count, "/api/v1/resource"));
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(document.bind<std::vector<std::string_view>>());
+	}
+	reportCounters(state, before, count);
+}
+BENCHMARK(BM_VectorStringView)->RangeMultiplier(16)->Range(16, 1 << 16);
@@ -0,0 +1,194 @@
+#include "bench.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace simple_yaml;
+using namespace simple_yaml::bench;
+
+namespace {
+
+// 1 KB .. 100 MB generated documents
+void documentSizes(benchmark::internal::Benchmark* b) {
+	for (int64_t size : {int64_t{1} << 10, int64_t{1} << 14, int64_t{1} << 17, int64_t{1} << 20, int64_t{1} << 24, int64_t{100} << 20}) {
+		b->Arg(size);
+	}
+	b->Unit(benchmark::kMillisecond);
+}
+
+void reportDocument(benchmark::State& state, std::size_t bytes, std::size_t allocationsBefore, std::size_t records) {
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+	reportCounters(state, allocationsBefore, records * recordFields);
+}
+
+} // namespace
+
+static void BM_FromString(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const Inventory inventory{fromString(source)};
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+}
+BENCHMARK(BM_FromString)->Apply(documentSizes);
+
+// Parse only, to separate YAML::Load cost from the binding cost
+static void BM_FromStringParseOnly(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(fromString(source));
+	}
+	reportDocument(state, source.size(), before, 0);
+}
+BENCHMARK(BM_FromStringParseOnly)->Apply(documentSizes);
+
+// Event-driven binding, no YAML::Node tree of the document
+static void BM_BindString(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const auto inventory = bindString<Inventory>(source);
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+}
+BENCHMARK(BM_BindString)->Apply(documentSizes);
+
+static void BM_FromFile(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+	const auto  path   = std::filesystem::temp_directory_path() / ("simple_yaml_bench_" + std::to_string(state.range(0)) + ".yaml");
+	std::ofstream{path, std::ios::binary} << source;
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const Inventory inventory{fromFile(path.string())};
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+
+	std::filesystem::remove(path);
+}
+BENCHMARK(BM_FromFile)->Apply(documentSizes);
+
+static void BM_FromMappedFile(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+	const auto  path   = std::filesystem::temp_directory_path() / ("simple_yaml_bench_mapped_" + std::to_string(state.range(0)) + ".yaml");
+	std::ofstream{path, std::ios::binary} << source;
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const Inventory inventory{fromMappedFile(path.string())};
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+
+	std::filesystem::remove(path);
+}
+BENCHMARK(BM_FromMappedFile)->Apply(documentSizes);
+
+// Configuration including the generated document, the fragment parsed before is copied from Includes::shared()
+static void BM_FromFileIncluded(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source    = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+	const auto  directory = std::filesystem::temp_directory_path();
+	const auto  fragment  = "simple_yaml_bench_fragment_" + std::to_string(state.range(0)) + ".yaml";
+	const auto  path      = directory / ("simple_yaml_bench_including_" + std::to_string(state.range(0)) + ".yaml");
+	std::ofstream{directory / fragment, std::ios::binary} << source;
+	std::ofstream{path, std::ios::binary} << "!include " << fragment << "\n";
+	fromFile(path.string());
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const Inventory inventory{fromFile(path.string())};
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+
+	Includes::shared().clear();
+	std::filesystem::remove(path);
+	std::filesystem::remove(directory / fragment);
+}
+BENCHMARK(BM_FromFileIncluded)->Apply(documentSizes);
+
+// Restart with an unchanged file, the document is bound from the compiled snapshot
+static void BM_CompiledCacheHit(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  source    = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+	const auto  directory = std::filesystem::temp_directory_path() / "simple_yaml_bench_cache";
+	const auto  path      = std::filesystem::temp_directory_path() / ("simple_yaml_bench_cached_" + std::to_string(state.range(0)) + ".yaml");
+	std::ofstream{path, std::ios::binary} << source;
+
+	CompiledCache cache{directory};
+	cache.bind<Inventory>(path.string());
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const auto inventory = cache.bind<Inventory>(path.string());
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportDocument(state, source.size(), before, records);
+
+	std::filesystem::remove(path);
+	std::filesystem::remove_all(directory);
+}
+BENCHMARK(BM_CompiledCacheHit)->Apply(documentSizes);
+
+// 32 fragments of the given size, one after another on the calling thread vs concurrently
+static std::vector<std::string> writeFragments(std::size_t bytes, std::size_t* records) {
+	std::vector<std::string> paths;
+	const auto               source = generateDocument(bytes, records);
+	for (int i = 0; i < 32; ++i) {
+		paths.push_back((std::filesystem::temp_directory_path() / ("simple_yaml_bench_fragment_" + std::to_string(i) + ".yaml")).string());
+		std::ofstream{paths.back(), std::ios::binary} << source;
+	}
+	*records *= paths.size();
+	return paths;
+}
+
+static void BM_FromFileEach(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  paths = writeFragments(static_cast<std::size_t>(state.range(0)), &records);
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		for (const auto& path : paths) {
+			const Inventory inventory{fromFile(path)};
+			benchmark::DoNotOptimize(inventory.records.data());
+		}
+	}
+	reportCounters(state, before, records * recordFields);
+
+	for (const auto& path : paths) {
+		std::filesystem::remove(path);
+	}
+}
+BENCHMARK(BM_FromFileEach)->Arg(1 << 14)->Arg(1 << 17)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_LoadAll(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  paths = writeFragments(static_cast<std::size_t>(state.range(0)), &records);
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(loadAll<Inventory>(paths));
+	}
+	reportCounters(state, before, records * recordFields);
+
+	for (const auto& path : paths) {
+		std::filesystem::remove(path);
+	}
+}
+BENCHMARK(BM_LoadAll)->Arg(1 << 14)->Arg(1 << 17)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+
+#include <memory_resource>
+
+using namespace simple_yaml;
+using namespace simple_yaml::bench;
+
+namespace {
+
+// Record with std::pmr members, allocated from the resource of the Memory::Scope
+struct PmrRecord : Simple {
+	using Simple::Simple;
+
+	std::pmr::string                   name    = bound("name");
+	std::pmr::string                   host    = bound("host");
+	uint16_t                           port    = bound("port");
+	double                             weight  = bound("weight");
+	bool                               enabled = bound("enabled", true);
+	std::chrono::seconds               timeout = bound("timeout");
+	std::pmr::vector<std::pmr::string> tags    = bound("tags");
+};
+
+struct PmrInventory : Simple {
+	using Simple::Simple;
+
+	std::pmr::string            version = bound("version");
+	std::pmr::vector<PmrRecord> records = bound("records");
+};
+
+void documentSizes(benchmark::internal::Benchmark* b) {
+	for (int64_t size : {int64_t{1} << 14, int64_t{1} << 20, int64_t{1} << 24}) {
+		b->Arg(size);
+	}
+	b->Unit(benchmark::kMillisecond);
+}
+
+} // namespace
+
+// Binding of a parsed document, strings and vectors allocated one by one
+static void BM_BindHeap(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  root = fromString(generateDocument(static_cast<std::size_t>(state.range(0)), &records));
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		Inventory inventory{root};
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_BindHeap)->Apply(documentSizes);
+
+// The same with std::pmr members from a monotonic arena per configuration, released at once
+static void BM_BindMonotonic(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  root = fromString(generateDocument(static_cast<std::size_t>(state.range(0)), &records));
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		std::pmr::monotonic_buffer_resource arena;
+		const auto                          inventory = bindAllocated<PmrInventory>(root, arena);
+		benchmark::DoNotOptimize(inventory.records.data());
+	}
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_BindMonotonic)->Apply(documentSizes);
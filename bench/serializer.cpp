@@ -0,0 +1,64 @@
+#include "bench.hpp"
+
+using namespace simple_yaml;
+using namespace simple_yaml::bench;
+
+namespace {
+
+// 16 KB .. 16 MB generated documents
+void documentSizes(benchmark::internal::Benchmark* b) {
+	for (int64_t size : {int64_t{1} << 14, int64_t{1} << 20, int64_t{1} << 24}) {
+		b->Arg(size);
+	}
+	b->Unit(benchmark::kMillisecond);
+}
+
+Inventory inventory(std::size_t bytes, std::size_t& records) {
+	return Inventory{fromString(generateDocument(bytes, &records))};
+}
+
+} // namespace
+
+// Serializer into one reused buffer
+static void BM_ToString(benchmark::State& state) {
+	std::size_t     records{0};
+	const Inventory source = inventory(static_cast<std::size_t>(state.range(0)), records);
+
+	std::string buffer;
+	const auto  before = allocations();
+	for (auto _ : state) {
+		toString(source, buffer);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_ToString)->Apply(documentSizes);
+
+// The same document through YAML::Emitter, as user code would write it without a Serializer
+static void BM_YamlEmitter(benchmark::State& state) {
+	std::size_t     records{0};
+	const Inventory source = inventory(static_cast<std::size_t>(state.range(0)), records);
+
+	std::size_t bytes{0};
+	const auto  before = allocations();
+	for (auto _ : state) {
+		YAML::Emitter out;
+		out << YAML::BeginMap << YAML::Key << "version" << YAML::Value << source.version << YAML::Key << "records" << YAML::Value << YAML::BeginSeq;
+		for (const auto& record : source.records) {
+			out << YAML::BeginMap;
+			out << YAML::Key << "name" << YAML::Value << record.name << YAML::Key << "host" << YAML::Value << record.host;
+			out << YAML::Key << "port" << YAML::Value << record.port << YAML::Key << "weight" << YAML::Value << record.weight;
+			out << YAML::Key << "enabled" << YAML::Value << record.enabled;
+			out << YAML::Key << "timeout" << YAML::Value << (std::to_string(record.timeout.count()) + "s");
+			out << YAML::Key << "tags" << YAML::Value << record.tags;
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq << YAML::EndMap;
+		bytes = out.size();
+		benchmark::DoNotOptimize(out.c_str());
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_YamlEmitter)->Apply(documentSizes);
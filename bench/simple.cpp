@@ -0,0 +1,238 @@
+#include "bench.hpp"
+
+using namespace simple_yaml;
+using namespace simple_yaml::bench;
+
+namespace {
+
+struct Validated : Simple {
+	using Simple::Simple;
+
+	std::string host = bound("host").addRuleRegex("^[a-z0-9.-]+$").addRuleLength(1, 253);
+	uint16_t    port = bound("port").addRuleMinimum<uint16_t>(1);
+};
+
+// Records with 64 keys, looked up key by key or dispatched in one pass over the mapping
+template<typename Base>
+struct WideFields : Base {
+	using Base::Base;
+
+	int k00 = this->bound("k00");
+	int k01 = this->bound("k01");
+	int k02 = this->bound("k02");
+	int k03 = this->bound("k03");
+	int k04 = this->bound("k04");
+	int k05 = this->bound("k05");
+	int k06 = this->bound("k06");
+	int k07 = this->bound("k07");
+	int k08 = this->bound("k08");
+	int k09 = this->bound("k09");
+	int k10 = this->bound("k10");
+	int k11 = this->bound("k11");
+	int k12 = this->bound("k12");
+	int k13 = this->bound("k13");
+	int k14 = this->bound("k14");
+	int k15 = this->bound("k15");
+	int k16 = this->bound("k16");
+	int k17 = this->bound("k17");
+	int k18 = this->bound("k18");
+	int k19 = this->bound("k19");
+	int k20 = this->bound("k20");
+	int k21 = this->bound("k21");
+	int k22 = this->bound("k22");
+	int k23 = this->bound("k23");
+	int k24 = this->bound("k24");
+	int k25 = this->bound("k25");
+	int k26 = this->bound("k26");
+	int k27 = this->bound("k27");
+	int k28 = this->bound("k28");
+	int k29 = this->bound("k29");
+	int k30 = this->bound("k30");
+	int k31 = this->bound("k31");
+	int k32 = this->bound("k32");
+	int k33 = this->bound("k33");
+	int k34 = this->bound("k34");
+	int k35 = this->bound("k35");
+	int k36 = this->bound("k36");
+	int k37 = this->bound("k37");
+	int k38 = this->bound("k38");
+	int k39 = this->bound("k39");
+	int k40 = this->bound("k40");
+	int k41 = this->bound("k41");
+	int k42 = this->bound("k42");
+	int k43 = this->bound("k43");
+	int k44 = this->bound("k44");
+	int k45 = this->bound("k45");
+	int k46 = this->bound("k46");
+	int k47 = this->bound("k47");
+	int k48 = this->bound("k48");
+	int k49 = this->bound("k49");
+	int k50 = this->bound("k50");
+	int k51 = this->bound("k51");
+	int k52 = this->bound("k52");
+	int k53 = this->bound("k53");
+	int k54 = this->bound("k54");
+	int k55 = this->bound("k55");
+	int k56 = this->bound("k56");
+	int k57 = this->bound("k57");
+	int k58 = this->bound("k58");
+	int k59 = this->bound("k59");
+	int k60 = this->bound("k60");
+	int k61 = this->bound("k61");
+	int k62 = this->bound("k62");
+	int k63 = this->bound("k63");
+};
+
+using Wide      = WideFields<Simple>;
+using WideKeyed = WideFields<Keyed<"k00", "k01", "k02", "k03", "k04", "k05", "k06", "k07", "k08", "k09", "k10", "k11", "k12", "k13", "k14",
+	                             "k15", "k16", "k17", "k18", "k19", "k20", "k21", "k22", "k23", "k24", "k25", "k26", "k27", "k28", "k29",
+	                             "k30", "k31", "k32", "k33", "k34", "k35", "k36", "k37", "k38", "k39", "k40", "k41", "k42", "k43", "k44",
+	                             "k45", "k46", "k47", "k48", "k49", "k50", "k51", "k52", "k53", "k54", "k55", "k56", "k57", "k58", "k59",
+	                             "k60", "k61", "k62", "k63">>;
+
+struct StaticValidated : Simple {
+	using Simple::Simple;
+
+	std::string host = bound("host").addRuleRegex<"^[a-z0-9.-]+$">().addRuleLength(1, 253);
+	uint16_t    port = bound("port").addRuleMinimum<uint16_t>(1);
+};
+
+} // namespace
+
+static void BM_Record(benchmark::State& state) {
+	const auto record = YAML::Load(R"(
+name: record
+host: host.example.com
+port: 8080
+weight: 0.5
+timeout: 1h 30m
+tags: [alpha, beta, gamma]
+)");
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<Record>::deserialize(record, "/bench"));
+	}
+	reportCounters(state, before, recordFields);
+}
+BENCHMARK(BM_Record);
+
+static void BM_RecordSequence(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  node = YAML::Load(generateDocument(static_cast<std::size_t>(state.range(0)), &records))["records"];
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<std::vector<Record>>::deserialize(node, "/records"));
+	}
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_RecordSequence)->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Unit(benchmark::kMicrosecond);
+
+static void BM_RecordSequenceParallel(benchmark::State& state) {
+	std::size_t records{0};
+	const auto  node = YAML::Load(generateDocument(static_cast<std::size_t>(state.range(0)), &records))["records"];
+
+	ThreadPool      pool;
+	Parallel::Scope scope{pool};
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<std::vector<Record>>::deserialize(node, "/records"));
+	}
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_RecordSequenceParallel)->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// Reload of a sequence where one record changed between loads
+static void BM_RecordSequenceReload(benchmark::State& state) {
+	std::size_t records{0};
+	auto        source = generateDocument(static_cast<std::size_t>(state.range(0)), &records);
+	const auto  node   = YAML::Load(source)["records"];
+	source.replace(source.find("port: 1024"), 10, "port: 1000");
+	const auto changed = YAML::Load(source)["records"];
+
+	Reloader<std::vector<Record>> reloader;
+	reloader.bind(node, "/records");
+
+	const auto before = allocations();
+	bool       flip{false};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reloader.bind((flip = !flip) ? changed : node, "/records"));
+	}
+	reportCounters(state, before, records * recordFields);
+}
+BENCHMARK(BM_RecordSequenceReload)->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Unit(benchmark::kMicrosecond);
+
+static void BM_ValidatedRecord(benchmark::State& state) {
+	const auto record = YAML::Load("{host: host.example.com, port: 8080}");
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<Validated>::deserialize(record, "/bench"));
+	}
+	reportCounters(state, before, 2);
+}
+BENCHMARK(BM_ValidatedRecord);
+
+static void BM_StaticValidatedRecord(benchmark::State& state) {
+	const auto record = YAML::Load("{host: host.example.com, port: 8080}");
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<StaticValidated>::deserialize(record, "/bench"));
+	}
+	reportCounters(state, before, 2);
+}
+BENCHMARK(BM_StaticValidatedRecord);
+
+// Node graph the bound inventory keeps alive once the document itself is gone, attached (0) or detached (1)
+static void BM_InventoryRetained(benchmark::State& state) {
+	const bool  detach = state.range(0) != 0;
+	const auto  source = generateDocument(1 << 20);
+	std::size_t retained{0};
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		const auto inventory = detach ? bindDetached<Inventory>(YAML::Load(source)) : Inventory{YAML::Load(source)};
+		retained             = inventory.retained().bytes;
+		benchmark::DoNotOptimize(inventory);
+	}
+	reportCounters(state, before, 0);
+	state.counters["retainedKb"] = static_cast<double>(retained) / 1024.0;
+}
+BENCHMARK(BM_InventoryRetained)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static std::string wideRecords(std::size_t count) {
+	std::string source;
+	for (std::size_t i = 0; i < count; ++i) {
+		source += "- {";
+		for (std::size_t k = 0; k < 64; ++k) {
+			source += (k == 0 ? "k" : ", k") + std::string{k < 10 ? "0" : ""} + std::to_string(k) + ": " + std::to_string(i + k);
+		}
+		source += "}\n";
+	}
+	return source;
+}
+
+template<typename T>
+static void wideSequence(benchmark::State& state) {
+	const auto count = static_cast<std::size_t>(state.range(0));
+	const auto node  = YAML::Load(wideRecords(count));
+
+	const auto before = allocations();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Deserializer<std::vector<T>>::deserialize(node, "/records"));
+	}
+	reportCounters(state, before, count * 64);
+}
+
+static void BM_WideRecords(benchmark::State& state) {
+	wideSequence<Wide>(state);
+}
+BENCHMARK(BM_WideRecords)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_WideRecordsKeyed(benchmark::State& state) {
+	wideSequence<WideKeyed>(state);
+}
+BENCHMARK(BM_WideRecordsKeyed)->Arg(1000)->Unit(benchmark::kMillisecond);
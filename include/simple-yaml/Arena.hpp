@@ -0,0 +1,87 @@
+#ifndef __SIMPLE_YAML_ARENA_HPP__
+#define __SIMPLE_YAML_ARENA_HPP__
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace simple_yaml {
+
+// Storage for deserialized values which are only referenced (std::span) by the bound structure.
+//
+// The arena belongs to a Document and is active on the current thread while the document is being bound, deserializers of
+// non-owning types allocate from `Arena::current()`. Moving the arena does not invalidate anything it handed out.
+class Arena {
+public:
+	Arena()                        = default;
+	Arena(const Arena&)            = delete;
+	Arena(Arena&&)                 = default;
+	Arena& operator=(const Arena&) = delete;
+	Arena& operator=(Arena&&)      = default;
+
+	template<typename T>
+	std::span<const T> keep(std::vector<T>&& values) {
+		auto  block = std::make_unique<VectorBlock<T>>(std::move(values));
+		auto& kept  = block->values;
+		_blocks.push_back(std::move(block));
+		return {kept.data(), kept.size()};
+	}
+
+	std::size_t blocks() const {
+		return _blocks.size();
+	}
+
+	static Arena& current() {
+		if (_current == nullptr) {
+			throw std::logic_error("Non-owning types (std::string_view, std::span) can be bound only through simple_yaml::Document");
+		}
+		return *_current;
+	}
+
+	static bool active() {
+		return _current != nullptr;
+	}
+
+	// Makes the arena current for the lifetime of the scope
+	class Scope {
+	public:
+		explicit Scope(Arena& arena) : _previous(_current) {
+			_current = &arena;
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_current = _previous;
+		}
+
+	private:
+		Arena* _previous;
+	};
+
+private:
+	struct Block {
+		virtual ~Block() = default;
+	};
+
+	template<typename T>
+	struct VectorBlock : Block {
+		explicit VectorBlock(std::vector<T>&& v) : values(std::move(v)) {
+		}
+
+		std::vector<T> values;
+	};
+
+	std::vector<std::unique_ptr<Block>> _blocks;
+
+	static inline thread_local Arena* _current{nullptr};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_ARENA_HPP__
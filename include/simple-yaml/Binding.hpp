@@ -0,0 +1,199 @@
+#ifndef __SIMPLE_YAML_BINDING_HPP__
+#define __SIMPLE_YAML_BINDING_HPP__
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Path.hpp"
+
+namespace simple_yaml::stream {
+
+// Type-erased deserialized value
+struct Value {
+	virtual ~Value() = default;
+};
+
+template<typename T>
+struct TypedValue : Value {
+	explicit TypedValue(T&& v) : value(std::move(v)) {
+	}
+
+	T value;
+};
+
+// Receives parser events of exactly one YAML value (scalar, null, sequence or map) and turns them into a value.
+//
+// Entries of collections are announced by `element()`, which returns the sink of the entry (for maps alternately the key and
+// the value). A sink is reusable, `release()` hands the value out and resets it.
+class Sink {
+public:
+	virtual ~Sink() = default;
+
+	virtual void at(const Path& path) = 0;
+
+	virtual void scalar(const YAML::Mark& mark, const std::string& tag, const std::string& value) = 0;
+	virtual void null(const YAML::Mark& mark)                                                      = 0;
+	virtual void beginSequence(const YAML::Mark& mark, const std::string& tag)                     = 0;
+	virtual void beginMap(const YAML::Mark& mark, const std::string& tag)                          = 0;
+	virtual Sink& element()                                                                        = 0;
+	virtual void  end()                                                                            = 0;
+
+	virtual std::unique_ptr<Value> release() = 0;
+};
+
+using SinkFactory = std::unique_ptr<Sink> (*)();
+
+// Defined in Stream.hpp
+template<typename T>
+std::unique_ptr<Sink> makeSink();
+
+inline std::unique_ptr<Sink> makeNodeSink();
+
+template<typename T>
+T placeholder();
+
+// Keys a Simple-derived structure binds and the types it binds them to, recorded by constructing the structure once
+class Schema {
+public:
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+	struct Entry {
+		std::string     key;
+		std::type_index type;
+		SinkFactory     factory;
+		bool            captured; // bound more than once, kept as a YAML::Node
+	};
+
+	template<typename T>
+	void record(std::string_view key) {
+		if (auto* entry = find(key)) {
+			capture(*entry);
+			return;
+		}
+		_entries.push_back({std::string{key}, typeid(T), &makeSink<T>, false});
+	}
+
+	void capture(std::string_view key) {
+		if (auto* entry = find(key)) {
+			capture(*entry);
+		}
+	}
+
+	// Sorts the entries for lookups, no more keys can be recorded
+	void seal() {
+		std::sort(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+	}
+
+	std::size_t indexOf(std::string_view key) const {
+		auto it = std::lower_bound(_entries.begin(), _entries.end(), key, [](const Entry& e, std::string_view k) { return e.key < k; });
+		return it != _entries.end() && it->key == key ? static_cast<std::size_t>(it - _entries.begin()) : npos;
+	}
+
+	const std::vector<Entry>& entries() const {
+		return _entries;
+	}
+
+private:
+	Entry* find(std::string_view key) {
+		auto it = std::find_if(_entries.begin(), _entries.end(), [&](const Entry& e) { return e.key == key; });
+		return it != _entries.end() ? &*it : nullptr;
+	}
+
+	static void capture(Entry& entry) {
+		entry.captured = true;
+		entry.factory  = &makeNodeSink;
+	}
+
+	std::vector<Entry> _entries;
+};
+
+// State a Simple-derived structure is constructed from when it is bound from a stream.
+//
+// While recording, fields register their keys in the schema and get placeholder values. Otherwise fields take values that were
+// already deserialized from the events of the structure's map.
+class Binding {
+public:
+	using Slots = std::vector<std::unique_ptr<Value>>;
+
+	explicit Binding(Schema& recorder) : _recorder(&recorder), _schema(&recorder) {
+	}
+
+	Binding(const Schema& schema, Slots& slots, const Path& path, const YAML::Mark& mark) : _schema(&schema), _slots(&slots), _path(path), _mark(mark) {
+	}
+
+	bool recording() const {
+		return _recorder != nullptr;
+	}
+
+	template<typename T>
+	void record(std::string_view key) {
+		_recorder->record<T>(key);
+	}
+
+	void capture(std::string_view key) {
+		_recorder->capture(key);
+	}
+
+	// Value of a field bound only once, empty when the key is not in the map
+	template<typename T>
+	std::optional<T> release(std::string_view key) {
+		auto* slot = find(key);
+		if (slot == nullptr) {
+			return std::nullopt;
+		}
+		auto* typed = dynamic_cast<TypedValue<T>*>(slot->get());
+		if (typed == nullptr) {
+			throw std::logic_error("Field \"" + std::string{key} + "\" was bound to a different type while recording the schema");
+		}
+		std::optional<T> value{std::move(typed->value)};
+		slot->reset();
+		return value;
+	}
+
+	// Node of a field bound several times, null when the key is not in the map or the field is bound only once
+	const YAML::Node* node(std::string_view key) const {
+		const auto index = _schema->indexOf(key);
+		if (index == Schema::npos || !_schema->entries()[index].captured || !(*_slots)[index]) {
+			return nullptr;
+		}
+		return &static_cast<const TypedValue<YAML::Node>&>(*(*_slots)[index]).value;
+	}
+
+	const Path& path() const {
+		return _path;
+	}
+
+	const YAML::Mark& mark() const {
+		return _mark;
+	}
+
+private:
+	std::unique_ptr<Value>* find(std::string_view key) {
+		const auto index = _schema->indexOf(key);
+		if (index == Schema::npos || !(*_slots)[index]) {
+			return nullptr;
+		}
+		return &(*_slots)[index];
+	}
+
+	Schema*       _recorder{nullptr};
+	const Schema* _schema;
+	Slots*        _slots{nullptr};
+	Path          _path;
+	YAML::Mark    _mark{YAML::Mark::null_mark()};
+};
+
+} // namespace simple_yaml::stream
+
+#endif // __SIMPLE_YAML_BINDING_HPP__
@@ -0,0 +1,308 @@
+#ifndef __SIMPLE_YAML_COMPILED_CACHE_HPP__
+#define __SIMPLE_YAML_COMPILED_CACHE_HPP__
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+#include <yaml-cpp/yaml.h>
+
+#include "Hash.hpp"
+#include "MappedFile.hpp"
+#include "Path.hpp"
+#include "Stream.hpp"
+
+namespace simple_yaml {
+
+namespace detail::snapshot {
+
+inline constexpr std::uint32_t magic   = 0x43594153; // "SAYC"
+inline constexpr std::uint32_t version = 1;
+
+struct Header {
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t contentHash;
+	std::uint64_t contentSize;
+	std::uint64_t eventsHash;
+};
+
+enum class Op : std::uint8_t { Null, Alias, Scalar, SequenceStart, SequenceEnd, MapStart, MapEnd };
+
+// Appends the parser events of a document to `out` and forwards them to the next handler
+class Writer : public YAML::EventHandler {
+public:
+	Writer(std::string& out, YAML::EventHandler& next) : _out(out), _next(next) {
+	}
+
+	void OnDocumentStart(const YAML::Mark& mark) override {
+		_next.OnDocumentStart(mark);
+	}
+
+	void OnDocumentEnd() override {
+		_next.OnDocumentEnd();
+	}
+
+	void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override {
+		op(Op::Null, mark, anchor);
+		_next.OnNull(mark, anchor);
+	}
+
+	void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override {
+		op(Op::Alias, mark, anchor);
+		_next.OnAlias(mark, anchor);
+	}
+
+	void OnScalar(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, const std::string& value) override {
+		op(Op::Scalar, mark, anchor);
+		text(tag);
+		text(value);
+		_next.OnScalar(mark, tag, anchor, value);
+	}
+
+	void OnSequenceStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) override {
+		op(Op::SequenceStart, mark, anchor);
+		text(tag);
+		put(static_cast<std::uint8_t>(style));
+		_next.OnSequenceStart(mark, tag, anchor, style);
+	}
+
+	void OnSequenceEnd() override {
+		put(Op::SequenceEnd);
+		_next.OnSequenceEnd();
+	}
+
+	void OnMapStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) override {
+		op(Op::MapStart, mark, anchor);
+		text(tag);
+		put(static_cast<std::uint8_t>(style));
+		_next.OnMapStart(mark, tag, anchor, style);
+	}
+
+	void OnMapEnd() override {
+		put(Op::MapEnd);
+		_next.OnMapEnd();
+	}
+
+private:
+	template<typename T>
+	void put(const T& value) {
+		_out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void op(Op code, const YAML::Mark& mark, YAML::anchor_t anchor) {
+		put(code);
+		put(static_cast<std::int32_t>(mark.pos));
+		put(static_cast<std::int32_t>(mark.line));
+		put(static_cast<std::int32_t>(mark.column));
+		put(static_cast<std::uint64_t>(anchor));
+	}
+
+	void text(const std::string& value) {
+		put(static_cast<std::uint32_t>(value.size()));
+		_out.append(value);
+	}
+
+	std::string&        _out;
+	YAML::EventHandler& _next;
+};
+
+// Sends the events stored by Writer to the handler as one document
+class Reader {
+public:
+	explicit Reader(std::string_view events) : _events(events) {
+	}
+
+	bool replay(YAML::EventHandler& handler) {
+		handler.OnDocumentStart(YAML::Mark::null_mark());
+		while (_offset < _events.size()) {
+			const auto code = get<Op>();
+			if (code == Op::SequenceEnd) {
+				handler.OnSequenceEnd();
+				continue;
+			}
+			if (code == Op::MapEnd) {
+				handler.OnMapEnd();
+				continue;
+			}
+
+			YAML::Mark mark;
+			mark.pos          = get<std::int32_t>();
+			mark.line         = get<std::int32_t>();
+			mark.column       = get<std::int32_t>();
+			const auto anchor = static_cast<YAML::anchor_t>(get<std::uint64_t>());
+			switch (code) {
+				case Op::Null:
+					handler.OnNull(mark, anchor);
+					break;
+				case Op::Alias:
+					handler.OnAlias(mark, anchor);
+					break;
+				case Op::Scalar:
+					text(_tag);
+					text(_value);
+					handler.OnScalar(mark, _tag, anchor, _value);
+					break;
+				case Op::SequenceStart:
+					text(_tag);
+					handler.OnSequenceStart(mark, _tag, anchor, static_cast<YAML::EmitterStyle::value>(get<std::uint8_t>()));
+					break;
+				case Op::MapStart:
+					text(_tag);
+					handler.OnMapStart(mark, _tag, anchor, static_cast<YAML::EmitterStyle::value>(get<std::uint8_t>()));
+					break;
+				default:
+					throw std::runtime_error("Corrupted snapshot");
+			}
+		}
+		handler.OnDocumentEnd();
+		return true;
+	}
+
+private:
+	template<typename T>
+	T get() {
+		T value;
+		read(&value, sizeof(value));
+		return value;
+	}
+
+	void text(std::string& out) {
+		const auto size = get<std::uint32_t>();
+		if (size > _events.size() - _offset) {
+			throw std::runtime_error("Corrupted snapshot");
+		}
+		out.assign(_events.data() + _offset, size);
+		_offset += size;
+	}
+
+	void read(void* out, std::size_t size) {
+		if (size > _events.size() - _offset) {
+			throw std::runtime_error("Corrupted snapshot");
+		}
+		std::memcpy(out, _events.data() + _offset, size);
+		_offset += size;
+	}
+
+	std::string_view _events;
+	std::size_t      _offset{0};
+	std::string      _tag;
+	std::string      _value;
+};
+
+} // namespace detail::snapshot
+
+// Opt-in cache of parsed configuration files for fast restarts.
+//
+// The first load of a file stores its parser events in a compact binary snapshot in the cache directory. Later loads of the
+// unchanged file (same content hash and size) map the snapshot and bind straight from it, no YAML is parsed. The snapshot holds
+// the document, not the bound values, so it is independent of the bound type and any structure can be bound from it. Snapshots
+// are native-endian, a snapshot of another format version or platform is simply rebuilt.
+class CompiledCache {
+public:
+	explicit CompiledCache(std::filesystem::path directory) : _directory(std::move(directory)) {
+	}
+
+	template<typename T>
+	T bind(const std::string& filename, const Path& path = {}) {
+		const MappedFile source{filename};
+		const auto       hash     = fnv1a(source.view());
+		const auto       snapshot = snapshotOf(filename);
+
+		if (auto mapped = open(snapshot, hash, source.size())) {
+			++_hits;
+			detail::snapshot::Reader reader{mapped->view().substr(sizeof(detail::snapshot::Header))};
+			return stream::bindEvents<T>([&](YAML::EventHandler& handler) { return reader.replay(handler); }, path);
+		}
+
+		++_misses;
+		std::string  events;
+		MemoryStream is{source.view()};
+		YAML::Parser parser{is};
+		auto         emit = [&](YAML::EventHandler& handler) {
+			detail::snapshot::Writer writer{events, handler};
+			return parser.HandleNextDocument(writer);
+		};
+
+		T value = stream::bindEvents<T>(emit, path);
+		store(snapshot, hash, source.size(), events);
+		return value;
+	}
+
+	// Snapshot file of a configuration file
+	std::filesystem::path snapshotOf(const std::string& filename) const {
+		char name[17];
+		std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fnv1a(std::filesystem::absolute(filename).string())));
+		return _directory / (std::string{name} + ".yamlc");
+	}
+
+	std::size_t hits() const {
+		return _hits;
+	}
+
+	std::size_t misses() const {
+		return _misses;
+	}
+
+private:
+	static std::optional<MappedFile> open(const std::filesystem::path& snapshot, std::uint64_t hash, std::size_t size) {
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(snapshot, ec)) {
+			return std::nullopt;
+		}
+		try {
+			MappedFile               file{snapshot.string()};
+			detail::snapshot::Header header{};
+			if (file.size() < sizeof(header)) {
+				return std::nullopt;
+			}
+			std::memcpy(&header, file.view().data(), sizeof(header));
+			const auto events = file.view().substr(sizeof(header));
+			if (header.magic != detail::snapshot::magic || header.version != detail::snapshot::version || header.contentHash != hash ||
+			    header.contentSize != size || header.eventsHash != fnv1a(events)) {
+				return std::nullopt;
+			}
+			return file;
+		} catch (const YAML::BadFile&) {
+			return std::nullopt;
+		}
+	}
+
+	// A snapshot that cannot be written only costs the next load a parse, so errors are ignored
+	void store(const std::filesystem::path& snapshot, std::uint64_t hash, std::size_t size, const std::string& events) const {
+		std::error_code ec;
+		std::filesystem::create_directories(_directory, ec);
+
+		const detail::snapshot::Header header{detail::snapshot::magic, detail::snapshot::version, hash, size, fnv1a(events)};
+		auto                           temporary = snapshot;
+		temporary += ".tmp";
+		{
+			std::ofstream out{temporary, std::ios::binary | std::ios::trunc};
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(events.data(), static_cast<std::streamsize>(events.size()));
+			if (!out) {
+				std::filesystem::remove(temporary, ec);
+				return;
+			}
+		}
+		std::filesystem::rename(temporary, snapshot, ec);
+	}
+
+	std::filesystem::path _directory;
+	std::size_t           _hits{0};
+	std::size_t           _misses{0};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_COMPILED_CACHE_HPP__
@@ -6,7 +6,12 @@
 #include <charconv>
 #include <chrono>
 #include <filesystem>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -14,8 +19,16 @@
 #	include <magic_enum.hpp>
 #endif
 
+#include "Arena.hpp"
+#include "Diagnostics.hpp"
+#include "Enum.hpp"
 #include "Exception.hpp"
+#include "Memory.hpp"
+#include "Number.hpp"
+#include "Parallel.hpp"
 #include "Parser.hpp"
+#include "Path.hpp"
+#include "Trace.hpp"
 
 namespace simple_yaml {
 
@@ -27,36 +40,77 @@ struct Deserializer {
 template<typename T>
 requires std::is_integral_v<T> || std::is_floating_point_v<T>
 struct Deserializer<T> {
-	static T deserialize(const YAML::Node& n, const std::string& path) {
+	static T deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing basic type node " + path, n.Mark());
 		}
 		if (!n.IsScalar()) {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
-		return n.as<T>();
+		detail::traceScalar();
+		if constexpr (std::is_same_v<T, bool>) {
+			bool value;
+			if (detail::parseBool(n.Scalar(), value) != detail::Conversion::Ok) {
+				throw InvalidValue<T>("Invalid boolean \"" + n.Scalar() + "\" at " + path, n.Mark());
+			}
+			return value;
+		} else if constexpr (detail::isNumber<T>) {
+			T value;
+			switch (detail::parseNumber(n.Scalar(), value)) {
+				case detail::Conversion::Ok:
+					return value;
+				case detail::Conversion::OutOfRange:
+					throw OutOfRange<T>("Value \"" + n.Scalar() + "\" out of range " + range() + " at " + path, n.Mark());
+				default:
+					throw InvalidValue<T>(std::string{"Invalid "} + (std::is_integral_v<T> ? "integer" : "number") + " \"" + n.Scalar() + "\" at " + path,
+					                      n.Mark());
+			}
+		} else {
+			return n.as<T>();
+		}
+	}
+
+private:
+	static std::string range() {
+		if constexpr (std::is_integral_v<T>) {
+			return "[" + std::to_string(std::numeric_limits<T>::min()) + ", " + std::to_string(std::numeric_limits<T>::max()) + "]";
+		} else {
+			return "of " + std::to_string(sizeof(T) * 8) + "-bit floating point";
+		}
 	}
 };
 
+namespace detail {
+
+// Element of a sequence of numbers, the exception is only built with the path when the conversion fails
+template<typename T>
+T numberAt(const YAML::Node& n, const Path& path, std::size_t index) {
+	T value;
+	if (n.IsScalar() && parseNumber(n.Scalar(), value) == Conversion::Ok) {
+		traceScalar();
+		return value;
+	}
+	return Deserializer<T>::deserialize(n, Path{path, index});
+}
+
+} // namespace detail
+
 #if defined(__has_include) && __has_include(<magic_enum.hpp>)
 
 template<typename T>
 requires std::is_enum_v<T>
 struct Deserializer<T> {
-	static T deserialize(const YAML::Node& n, const std::string& path) {
+	static T deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing basic type node " + path, n.Mark());
 		}
 		if (!n.IsScalar()) {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
-		auto en = magic_enum::enum_cast<T>(n.as<std::string>());
+		detail::traceScalar();
+		auto en = detail::EnumNames<T>::find(n.Scalar());
 		if (!en.has_value()) {
-			std::string values;
-			for (auto a : magic_enum::enum_names<T>()) {
-				values += " " + std::string{a};
-			}
-			throw InvalidNodeType("Invalid enum value \"" + n.as<std::string>() + "\" (possible:" + values + ") at " + path, n.Mark());
+			throw InvalidNodeType("Invalid enum value \"" + n.Scalar() + "\" (possible:" + detail::EnumNames<T>::list() + ") at " + path, n.Mark());
 		}
 		return en.value();
 	}
@@ -67,15 +121,16 @@ struct Deserializer<T> {
 // chrono durations as int64_t
 template<typename Rep, typename Period>
 struct Deserializer<std::chrono::duration<Rep, Period>> {
-	static std::chrono::duration<Rep, Period> deserialize(const YAML::Node& n, const std::string& path) {
+	static std::chrono::duration<Rep, Period> deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing basic type node " + path, n.Mark());
 		}
 		if (!n.IsScalar()) {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
-		const auto string = n.as<std::string>();
-		Rep        result;
+		detail::traceScalar();
+		const std::string_view string = n.Scalar();
+		Rep                    result;
 		if (auto [ptr, ec] = std::from_chars(string.data(), string.data() + string.size(), result); ec == std::errc() && ptr == string.data() + string.size()) {
 			return std::chrono::duration<Rep, Period>{result};
 		}
@@ -85,22 +140,39 @@ struct Deserializer<std::chrono::duration<Rep, Period>> {
 
 // Representable as a string
 template<typename T>
-requires std::is_same_v<T, std::string> || std::is_same_v<T, std::filesystem::path>
+requires std::is_same_v<T, std::string> || std::is_same_v<T, std::pmr::string> || std::is_same_v<T, std::filesystem::path>
 struct Deserializer<T> {
-	static T deserialize(const YAML::Node& n, const std::string& path) {
+	static T deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing basic type node " + path, n.Mark());
 		}
 		if (!n.IsScalar()) {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
-		return n.as<std::string>();
+		detail::traceScalar();
+		return detail::make<T>(n.Scalar());
+	}
+};
+
+// Refers to the scalar stored in the document, valid as long as the Document it was bound from
+template<>
+struct Deserializer<std::string_view> {
+	static std::string_view deserialize(const YAML::Node& n, const Path& path) {
+		Arena::current(); // only a Document guarantees the scalar outlives the view
+		if (!n.IsDefined()) {
+			throw MissingNode("Missing basic type node " + path, n.Mark());
+		}
+		if (!n.IsScalar()) {
+			throw InvalidNodeType("Invalid node type " + path, n.Mark());
+		}
+		detail::traceScalar();
+		return n.Scalar();
 	}
 };
 
 template<typename T, size_t N>
 struct Deserializer<std::array<T, N>> {
-	static std::array<T, N> deserialize(const YAML::Node& n, const std::string& path) {
+	static std::array<T, N> deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing Array[" + std::to_string(N) + "] node " + path, n.Mark());
 		}
@@ -110,33 +182,100 @@ struct Deserializer<std::array<T, N>> {
 		}
 
 		std::array<T, N> ret;
-		for (size_t i{0}; i < N; ++i) {
-			ret[i] = Deserializer<T>::deserialize(n[i], path + "[" + std::to_string(i) + "]");
+		size_t           i{0};
+		for (const auto& in : n) {
+			if constexpr (detail::isNumber<T>) {
+				ret[i] = detail::numberAt<T>(in, path, i);
+			} else {
+				ret[i] = Deserializer<T>::deserialize(in, Path{path, i});
+			}
+			++i;
 		}
 		return ret;
 	}
 };
 
-template<typename T>
-struct Deserializer<std::vector<T>> {
-	static std::vector<T> deserialize(const YAML::Node& n, const std::string& path) {
+template<typename T, typename Allocator>
+struct Deserializer<std::vector<T, Allocator>> {
+	using Vector = std::vector<T, Allocator>;
+
+	static Vector deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing sequence node " + path, n.Mark());
 		}
-		std::vector<T> ret;
-		size_t         i{0};
+		if (Diagnostics::current() != nullptr && n.IsSequence()) {
+			return collected(n, path);
+		}
+		if (const auto* parallel = n.IsSequence() ? Parallel::worth(n.size()) : nullptr) {
+			return deserialize(*parallel, n, path);
+		}
+		Vector ret = detail::make<Vector>();
+		size_t i{0};
+		if (n.IsSequence()) {
+			// structures are copied when the vector grows, copies of std::pmr members would use the default resource
+			ret.reserve(n.size());
+		}
+		if constexpr (detail::isNumber<T>) {
+			if (n.IsSequence()) {
+				for (const auto& in : n) {
+					ret.push_back(detail::numberAt<T>(in, path, i++));
+				}
+				return ret;
+			}
+		}
+		for (const auto& in : n) {
+			ret.push_back(Deserializer<T>::deserialize(in, Path{path, i++}));
+		}
+		return ret;
+	}
+
+private:
+	// Failed elements are recorded and left out
+	static Vector collected(const YAML::Node& n, const Path& path) {
+		Vector ret = detail::make<Vector>();
+		ret.reserve(n.size());
+		size_t i{0};
 		for (const auto& in : n) {
-			ret.push_back(Deserializer<T>::deserialize(in, path + "[" + std::to_string(i++) + "]"));
+			const Path elementPath{path, i++};
+			Diagnostics::attempt(elementPath, in.Mark(), [&] { ret.push_back(Deserializer<T>::deserialize(in, elementPath)); });
+		}
+		return ret;
+	}
+
+	static Vector deserialize(const Parallel& parallel, const YAML::Node& n, const Path& path) {
+		const std::vector<YAML::Node> items(n.begin(), n.end());
+		if constexpr (detail::isNumber<T>) {
+			Vector ret(items.size());
+			parallel.forEach(items.size(), [&](std::size_t i) { ret[i] = detail::numberAt<T>(items[i], path, i); });
+			return ret;
+		}
+
+		std::vector<std::optional<T>> values(items.size());
+		parallel.forEach(items.size(), [&](std::size_t i) { values[i].emplace(Deserializer<T>::deserialize(items[i], Path{path, i})); });
+
+		Vector ret = detail::make<Vector>();
+		ret.reserve(values.size());
+		for (auto& value : values) {
+			ret.push_back(std::move(*value));
 		}
 		return ret;
 	}
 };
 
+// Elements are stored in the arena of the Document the span was bound from
+template<typename T>
+struct Deserializer<std::span<const T>> {
+	static std::span<const T> deserialize(const YAML::Node& n, const Path& path) {
+		auto& arena = Arena::current();
+		return arena.keep(Deserializer<std::vector<T>>::deserialize(n, path));
+	}
+};
+
 // Associative containers
 template<typename T>
 requires std::is_destructible_v<typename T::key_type> || std::is_destructible_v<typename T::mapped_type>
 struct Deserializer<T> {
-	static T deserialize(const YAML::Node& n, const std::string& path) {
+	static T deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing basic type node " + path, n.Mark());
 		}
@@ -144,15 +283,59 @@ struct Deserializer<T> {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
 
-		T result;
+		if (Diagnostics::current() != nullptr) {
+			return collected(n, path);
+		}
+		if (const auto* parallel = Parallel::worth(n.size())) {
+			return deserialize(*parallel, n, path);
+		}
+
+		T result = detail::make<T>();
 		for (YAML::const_iterator it = n.begin(); it != n.end(); ++it) {
-			auto fullpath = path + "/" + it->first.as<std::string>();
-			auto key      = simple_yaml::Deserializer<std::decay_t<typename T::key_type>>::deserialize(it->first, path);
-			auto value    = simple_yaml::Deserializer<std::decay_t<typename T::mapped_type>>::deserialize(it->second, fullpath);
+			auto [key, value] = entry(it->first, it->second, path);
 			result.emplace(std::move(key), std::move(value));
 		}
 		return result;
 	}
+
+private:
+	using Key    = std::decay_t<typename T::key_type>;
+	using Mapped = std::decay_t<typename T::mapped_type>;
+
+	static std::pair<Key, Mapped> entry(const YAML::Node& key, const YAML::Node& value, const Path& path) {
+		const Path fullpath{path, key.Scalar()};
+		auto       k = simple_yaml::Deserializer<Key>::deserialize(key, path);
+		return {std::move(k), simple_yaml::Deserializer<Mapped>::deserialize(value, fullpath)};
+	}
+
+	// Failed entries are recorded and left out
+	static T collected(const YAML::Node& n, const Path& path) {
+		T result = detail::make<T>();
+		for (YAML::const_iterator it = n.begin(); it != n.end(); ++it) {
+			Diagnostics::attempt(Path{path, it->first.Scalar()}, it->second.Mark(), [&] {
+				auto [key, value] = entry(it->first, it->second, path);
+				result.emplace(std::move(key), std::move(value));
+			});
+		}
+		return result;
+	}
+
+	// Entries are inserted in document order, so multimaps keep the order of equal keys
+	static T deserialize(const Parallel& parallel, const YAML::Node& n, const Path& path) {
+		std::vector<std::pair<YAML::Node, YAML::Node>> items;
+		items.reserve(n.size());
+		for (YAML::const_iterator it = n.begin(); it != n.end(); ++it) {
+			items.emplace_back(it->first, it->second);
+		}
+		std::vector<std::optional<std::pair<Key, Mapped>>> entries(items.size());
+		parallel.forEach(items.size(), [&](std::size_t i) { entries[i].emplace(entry(items[i].first, items[i].second, path)); });
+
+		T result;
+		for (auto& e : entries) {
+			result.emplace(std::move(e->first), std::move(e->second));
+		}
+		return result;
+	}
 };
 
 } // namespace simple_yaml
@@ -0,0 +1,92 @@
+#ifndef __SIMPLE_YAML_DETACH_HPP__
+#define __SIMPLE_YAML_DETACH_HPP__
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <yaml-cpp/yaml.h>
+
+namespace simple_yaml {
+
+// While a Detach::Scope is alive on the binding thread, every Simple-derived structure drops its node handle as soon as it is
+// constructed (see Simple::detach). Any node handle keeps the whole parsed document alive, so a configuration bound this way
+// does not hold on to the document after binding. Containers deserialized in parallel detach their elements too.
+class Detach {
+public:
+	class Scope {
+	public:
+		explicit Scope(bool detach = true) : _previous(std::exchange(_active, detach)) {
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_active = _previous;
+		}
+
+	private:
+		bool _previous;
+	};
+
+	static bool active() {
+		return _active;
+	}
+
+private:
+	static inline thread_local bool _active{false};
+};
+
+// Estimated memory of a node graph: the nodes with their shared state, scalars, tags and entry arrays
+struct Footprint {
+	std::size_t nodes{0};
+	std::size_t bytes{0};
+};
+
+// Aliased subtrees are counted every time they are referenced
+inline Footprint footprint(const YAML::Node& n) {
+	// node, node_ref and node_data, their shared_ptr control blocks (vtable and two counts) and the tree node of the entry in the
+	// memory holder of the document (three links and the color, then the shared_ptr)
+	constexpr std::size_t perNode = sizeof(YAML::detail::node) + sizeof(YAML::detail::node_ref) + sizeof(YAML::detail::node_data) + 3 * 3 * sizeof(void*) +
+	                                4 * sizeof(void*) + sizeof(std::shared_ptr<YAML::detail::node>);
+	// short strings are stored inline
+	const auto heap = [](const std::string& text) { return text.capacity() > std::string{}.capacity() ? text.capacity() + 1 : 0; };
+
+	Footprint result;
+	if (!n.IsDefined()) {
+		return result;
+	}
+	result.nodes = 1;
+	result.bytes = perNode + heap(n.Tag());
+	const auto add = [&result](const Footprint& other) {
+		result.nodes += other.nodes;
+		result.bytes += other.bytes;
+	};
+	switch (n.Type()) {
+		case YAML::NodeType::Scalar:
+			result.bytes += heap(n.Scalar());
+			break;
+		case YAML::NodeType::Sequence:
+			result.bytes += n.size() * sizeof(YAML::detail::node*);
+			for (const auto& element : n) {
+				add(footprint(element));
+			}
+			break;
+		case YAML::NodeType::Map:
+			result.bytes += n.size() * 2 * sizeof(YAML::detail::node*);
+			for (auto it = n.begin(); it != n.end(); ++it) {
+				add(footprint(it->first));
+				add(footprint(it->second));
+			}
+			break;
+		default:
+			break;
+	}
+	return result;
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_DETACH_HPP__
@@ -0,0 +1,93 @@
+#ifndef __SIMPLE_YAML_DIAGNOSTICS_HPP__
+#define __SIMPLE_YAML_DIAGNOSTICS_HPP__
+#pragma once
+
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Exception.hpp"
+#include "Path.hpp"
+
+namespace simple_yaml {
+
+// One failure found while binding
+struct Diagnostic {
+	std::string message;
+	std::string path; // of the field or container entry which failed
+	YAML::Mark  mark;
+};
+
+// While a Diagnostics::Scope is alive on the binding thread, failures are recorded instead of thrown and binding goes on.
+//
+// A field which fails keeps its default value, or a value-initialized one (structures are bound from an empty mapping, their
+// own failures are not reported), a field which fails a rule keeps the converted value. Failed entries of sequences and maps are
+// left out. Containers are deserialized serially while collecting, so the diagnostics are in document order.
+class Diagnostics {
+public:
+	class Scope {
+	public:
+		explicit Scope(Diagnostics* diagnostics) : _previous(std::exchange(_current, diagnostics)) {
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_current = _previous;
+		}
+
+	private:
+		Diagnostics* _previous;
+	};
+
+	static Diagnostics* current() {
+		return _current;
+	}
+
+	// Calls `body`, false when it failed and the failure was recorded (only while collecting, otherwise it propagates)
+	template<typename Body>
+	static bool attempt(const Path& path, const YAML::Mark& mark, Body&& body) {
+		auto* diagnostics = _current;
+		if (diagnostics == nullptr) {
+			body();
+			return true;
+		}
+		try {
+			body();
+			return true;
+		} catch (const std::exception& e) {
+			diagnostics->add(e, path, mark);
+			return false;
+		}
+	}
+
+	// The mark of the exception is preferred, `mark` is the position of the failed field
+	void add(const std::exception& e, const std::string& path, YAML::Mark mark) {
+		if (const auto* located = dynamic_cast<const Exception*>(&e); located != nullptr && !located->yamlMark().is_null()) {
+			mark = located->yamlMark();
+		} else if (const auto* yaml = dynamic_cast<const YAML::Exception*>(&e); yaml != nullptr && !yaml->mark.is_null()) {
+			mark = yaml->mark;
+		}
+		_errors.push_back({e.what(), path, mark});
+	}
+
+	const std::vector<Diagnostic>& errors() const {
+		return _errors;
+	}
+
+	bool empty() const {
+		return _errors.empty();
+	}
+
+private:
+	std::vector<Diagnostic> _errors;
+
+	static inline thread_local Diagnostics* _current{nullptr};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_DIAGNOSTICS_HPP__
@@ -0,0 +1,63 @@
+#ifndef __SIMPLE_YAML_DOCUMENT_HPP__
+#define __SIMPLE_YAML_DOCUMENT_HPP__
+#pragma once
+
+#include <istream>
+#include <string>
+#include <yaml-cpp/yaml.h>
+
+#include "Arena.hpp"
+#include "Field.hpp"
+#include "Path.hpp"
+#include "Simple.hpp"
+
+namespace simple_yaml {
+
+// Parsed YAML document which owns everything non-owning fields (std::string_view, std::span) refer to.
+//
+// The document must outlive every structure bound from it. Scalars are referenced in place, so a sequence of strings costs no
+// copies, only the element arrays of spans are stored in the document's arena.
+class Document {
+public:
+	explicit Document(YAML::Node root) : _root(std::move(root)) {
+	}
+
+	static Document fromString(const std::string& str) {
+		return Document{YAML::Load(str)};
+	}
+
+	static Document fromStream(std::istream& is) {
+		return Document{YAML::Load(is)};
+	}
+
+	static Document fromFile(const std::string& filename) {
+		return Document{simple_yaml::fromFile(filename)};
+	}
+
+	// Views of the document refer to its nodes, not to the mapping, see simple_yaml::fromMappedFile
+	static Document fromMappedFile(const std::string& filename) {
+		return Document{simple_yaml::fromMappedFile(filename)};
+	}
+
+	template<typename T>
+	requires deserializable_v<T> T bind(const Path& path = {}) {
+		Arena::Scope scope{_arena};
+		return Deserializer<T>::deserialize(_root, path);
+	}
+
+	const YAML::Node& root() const {
+		return _root;
+	}
+
+	const Arena& arena() const {
+		return _arena;
+	}
+
+private:
+	YAML::Node _root;
+	Arena      _arena;
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_DOCUMENT_HPP__
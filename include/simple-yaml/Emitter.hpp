@@ -0,0 +1,245 @@
+#ifndef __SIMPLE_YAML_EMITTER_HPP__
+#define __SIMPLE_YAML_EMITTER_HPP__
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Number.hpp"
+
+namespace simple_yaml {
+
+template<typename T>
+struct Serializer;
+
+// Writes block-style YAML straight into a string, without building a node tree.
+//
+// Collections are opened and closed explicitly, their entries are laid out as they are written: nested mappings and sequences
+// start on the next line, one level deeper, the first entry of an element of a sequence stays on the line of its `- `. Empty
+// collections are written as `{}` and `[]`. The output is appended, so one buffer can be reused for many documents.
+class Emitter {
+public:
+	explicit Emitter(std::string& out) : _out(out) {
+	}
+
+	Emitter(const Emitter&)            = delete;
+	Emitter& operator=(const Emitter&) = delete;
+
+	// Scalar written as is, the caller makes sure it reads back as intended (numbers, booleans)
+	Emitter& scalar(std::string_view text) {
+		if (_key) {
+			_key = false;
+			keyText(text);
+			return *this;
+		}
+		value();
+		_out.append(text);
+		_out += '\n';
+		_after = After::LineStart;
+		return *this;
+	}
+
+	// String scalar, quoted when it would not read back as the same string
+	Emitter& string(std::string_view text) {
+		if (!needsQuotes(text)) {
+			return scalar(text);
+		}
+		_quoted.clear();
+		quote(text, _quoted);
+		return scalar(_quoted);
+	}
+
+	// The next scalar is the key of an entry of the current mapping
+	Emitter& key() {
+		if (_stack.empty() || _stack.back().kind != Kind::Map) {
+			throw std::logic_error("A key can be written only inside a mapping");
+		}
+		_key = true;
+		return *this;
+	}
+
+	Emitter& key(std::string_view name) {
+		return key().string(name);
+	}
+
+	template<typename T>
+	Emitter& value(const T& value) {
+		Serializer<T>::serialize(*this, value);
+		return *this;
+	}
+
+	template<typename T>
+	Emitter& entry(std::string_view name, const T& value) {
+		return key(name).value(value);
+	}
+
+	Emitter& beginMap() {
+		return begin(Kind::Map);
+	}
+
+	Emitter& endMap() {
+		return end(Kind::Map, "{}");
+	}
+
+	Emitter& beginSequence() {
+		return begin(Kind::Sequence);
+	}
+
+	// Starts the next element of the current sequence
+	Emitter& element() {
+		if (_stack.empty() || _stack.back().kind != Kind::Sequence) {
+			throw std::logic_error("An element can be written only inside a sequence");
+		}
+		auto& context = _stack.back();
+		newLine(context);
+		_out += "- ";
+		_after = After::Dash;
+		return *this;
+	}
+
+	Emitter& endSequence() {
+		return end(Kind::Sequence, "[]");
+	}
+
+private:
+	enum class Kind { Map, Sequence };
+
+	// What was written last on the current line
+	enum class After { LineStart, Key, Dash };
+
+	struct Context {
+		Kind        kind;
+		std::size_t column;
+		bool        empty;
+	};
+
+	// Keys are written only after this check, collections cannot be keys
+	void checkValue() const {
+		if (_key) {
+			throw std::logic_error("Only scalars can be serialized as keys");
+		}
+	}
+
+	void value() {
+		checkValue();
+		if (_after == After::Key) {
+			_out += ' ';
+		}
+	}
+
+	void keyText(std::string_view text) {
+		newLine(_stack.back());
+		_out.append(text);
+		_out += ':';
+		_after = After::Key;
+	}
+
+	// Moves to the column of the next entry of the collection, the first entry after `- ` stays on its line
+	void newLine(Context& context) {
+		if (_after == After::Key || (_after == After::Dash && !context.empty)) {
+			_out += '\n';
+			_after = After::LineStart;
+		}
+		if (_after == After::LineStart) {
+			_out.append(context.column, ' ');
+		}
+		context.empty = false;
+	}
+
+	Emitter& begin(Kind kind) {
+		checkValue();
+		std::size_t column = 0;
+		if (!_stack.empty()) {
+			column = _stack.back().column + 2;
+		}
+		_stack.push_back({kind, column, true});
+		return *this;
+	}
+
+	Emitter& end(Kind kind, std::string_view empty) {
+		if (_stack.empty() || _stack.back().kind != kind || _key) {
+			throw std::logic_error("Unbalanced collections in the emitter");
+		}
+		const bool wasEmpty = _stack.back().empty;
+		_stack.pop_back();
+		if (wasEmpty) {
+			value();
+			_out.append(empty);
+			_out += '\n';
+			_after = After::LineStart;
+		}
+		return *this;
+	}
+
+	static bool needsQuotes(std::string_view text) {
+		if (text.empty() || text.front() == ' ' || text.back() == ' ' || text.back() == ':') {
+			return true;
+		}
+		if (std::string_view{"-?:,[]{}#&*!|>'\"%@`"}.find(text.front()) != std::string_view::npos) {
+			return true;
+		}
+		for (std::size_t i = 0; i < text.size(); ++i) {
+			const auto c = static_cast<unsigned char>(text[i]);
+			if (c < 0x20 || c == 0x7f || c == '"' || c == '\\') {
+				return true;
+			}
+			if ((c == ':' && i + 1 < text.size() && text[i + 1] == ' ') || (c == '#' && text[i - 1] == ' ')) {
+				return true;
+			}
+		}
+		// plain scalars which would resolve to something else than a string
+		if (text == "~" || text == "null" || text == "Null" || text == "NULL") {
+			return true;
+		}
+		bool   boolean;
+		double number;
+		return detail::parseBool(text, boolean) == detail::Conversion::Ok || detail::parseNumber(text, number) != detail::Conversion::Invalid;
+	}
+
+	static void quote(std::string_view text, std::string& out) {
+		constexpr char hex[] = "0123456789ABCDEF";
+
+		out += '"';
+		for (const char c : text) {
+			switch (c) {
+				case '"':
+					out += "\\\"";
+					break;
+				case '\\':
+					out += "\\\\";
+					break;
+				case '\n':
+					out += "\\n";
+					break;
+				case '\t':
+					out += "\\t";
+					break;
+				case '\r':
+					out += "\\r";
+					break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20 || c == 0x7f) {
+						out += "\\x";
+						out += hex[static_cast<unsigned char>(c) >> 4];
+						out += hex[static_cast<unsigned char>(c) & 0xf];
+					} else {
+						out += c;
+					}
+			}
+		}
+		out += '"';
+	}
+
+	std::string&         _out;
+	std::vector<Context> _stack;
+	std::string          _quoted;
+	After                _after{After::LineStart};
+	bool                 _key{false};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_EMITTER_HPP__
@@ -0,0 +1,55 @@
+#ifndef __SIMPLE_YAML_ENUM_HPP__
+#define __SIMPLE_YAML_ENUM_HPP__
+#pragma once
+
+#if defined(__has_include) && __has_include(<magic_enum.hpp>)
+
+#	include <optional>
+#	include <string>
+#	include <string_view>
+#	include <magic_enum.hpp>
+
+#	include "PerfectHash.hpp"
+
+namespace simple_yaml {
+
+namespace detail {
+
+// Names of an enum, looked up through a perfect hash
+template<typename T>
+class EnumNames {
+	static constexpr auto names  = magic_enum::enum_names<T>();
+	static constexpr auto values = magic_enum::enum_values<T>();
+
+	static constexpr PerfectHash<names.size()> table{names};
+
+public:
+	static constexpr std::optional<T> find(std::string_view name) {
+		const auto index = table.find(name);
+		if (index == table.npos) {
+			return std::nullopt;
+		}
+		return values[index];
+	}
+
+	// ` A B C`, built once per enum for error messages
+	static const std::string& list() {
+		static const std::string result = [] {
+			std::string out;
+			for (const auto name : names) {
+				out += ' ';
+				out += name;
+			}
+			return out;
+		}();
+		return result;
+	}
+};
+
+} // namespace detail
+
+} // namespace simple_yaml
+
+#endif
+
+#endif // __SIMPLE_YAML_ENUM_HPP__
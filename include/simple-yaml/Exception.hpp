@@ -4,6 +4,8 @@
 
 #include <source_location>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <yaml-cpp/yaml.h>
 
 namespace simple_yaml {
@@ -12,6 +14,7 @@ class Exception {
 public:
 	virtual std::string location() const     = 0;
 	virtual std::string yamlLocation() const = 0;
+	virtual ::YAML::Mark yamlMark() const    = 0;
 
 	virtual ~Exception() = default;
 };
@@ -20,7 +23,7 @@ template<typename Parent>
 class BaseException : public Parent, public Exception {
 public:
 	BaseException(const std::string& what, ::YAML::Mark mark, std::source_location loc = std::source_location::current())
-	    : Parent(what), _what(what), _mark(mark), _loc(loc) {
+	    : Parent(parent(what, mark)), _what(what), _mark(mark), _loc(loc) {
 	}
 
 	const char* what() const noexcept override {
@@ -35,9 +38,22 @@ public:
 		return std::string{"@"} + std::to_string(_mark.line) + ":" + std::to_string(_mark.column);
 	}
 
+	::YAML::Mark yamlMark() const override {
+		return _mark;
+	}
+
 	~BaseException() override = default;
 
 private:
+	// yaml-cpp exceptions are built from the mark, they get the message through what()
+	static Parent parent(const std::string& what, ::YAML::Mark mark) {
+		if constexpr (std::is_constructible_v<Parent, const std::string&>) {
+			return Parent(what);
+		} else {
+			return Parent(mark);
+		}
+	}
+
 	std::string          _what;
 	::YAML::Mark         _mark;
 	std::source_location _loc;
@@ -62,6 +78,18 @@ struct InvalidNode : RuntimeError {
 	using RuntimeError::RuntimeError;
 };
 
+// Scalar that is not a value of the arithmetic type, caught as YAML::TypedBadConversion<T> like the yaml-cpp conversion
+template<typename T>
+struct InvalidValue : BaseException<::YAML::TypedBadConversion<T>> {
+	using BaseException<::YAML::TypedBadConversion<T>>::BaseException;
+};
+
+// Number outside of the range of the type
+template<typename T>
+struct OutOfRange : InvalidValue<T> {
+	using InvalidValue<T>::InvalidValue;
+};
+
 } // namespace simple_yaml
 
 #endif // __SIMPLE_YAML_EXCEPTION_HPP__
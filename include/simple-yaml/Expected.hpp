@@ -0,0 +1,129 @@
+#ifndef __SIMPLE_YAML_EXPECTED_HPP__
+#define __SIMPLE_YAML_EXPECTED_HPP__
+#pragma once
+
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <version>
+#include <yaml-cpp/yaml.h>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#	include <expected>
+#endif
+
+namespace simple_yaml {
+
+// Failure of the exception-free API. The message is formatted only when asked for.
+struct Error {
+	enum class Kind { Parse, MissingNode, InvalidNodeType, InvalidValue, OutOfRange, ValidationFailed };
+
+	Kind        kind;
+	std::string path;
+	YAML::Mark  mark;
+	std::string text; // the offending scalar, the message of the rule or of the parser
+
+	std::string message() const {
+		switch (kind) {
+			case Kind::Parse:
+				return text;
+			case Kind::MissingNode:
+				return "Missing node " + path;
+			case Kind::InvalidNodeType:
+				return "Invalid node type " + path;
+			case Kind::InvalidValue:
+				return "Invalid value \"" + text + "\" at " + path;
+			case Kind::OutOfRange:
+				return "Value \"" + text + "\" out of range at " + path;
+			default:
+				return text.empty() ? "Validation failed for " + path : text;
+		}
+	}
+};
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+
+template<typename T>
+using Expected = std::expected<T, Error>;
+
+using Unexpected = std::unexpected<Error>;
+
+#else
+
+// Stand-in for std::unexpected<Error> before C++23
+class Unexpected {
+public:
+	explicit Unexpected(Error error) : _error(std::move(error)) {
+	}
+
+	const Error& error() const& noexcept {
+		return _error;
+	}
+
+	Error&& error() && noexcept {
+		return std::move(_error);
+	}
+
+private:
+	Error _error;
+};
+
+// Stand-in for std::expected<T, Error> before C++23, with the accessors which do not throw
+template<typename T>
+class Expected {
+public:
+	template<typename U = T>
+	requires std::is_constructible_v<T, U&&> && (!std::is_same_v<std::decay_t<U>, Expected>) && (!std::is_same_v<std::decay_t<U>, Unexpected>)
+	Expected(U&& value) : _value(std::in_place, std::forward<U>(value)) {
+	}
+
+	Expected(Unexpected unexpected) : _error(std::move(unexpected).error()) {
+	}
+
+	bool has_value() const noexcept {
+		return _value.has_value();
+	}
+
+	explicit operator bool() const noexcept {
+		return has_value();
+	}
+
+	T& operator*() & noexcept {
+		return *_value;
+	}
+
+	const T& operator*() const& noexcept {
+		return *_value;
+	}
+
+	T&& operator*() && noexcept {
+		return std::move(*_value);
+	}
+
+	T* operator->() noexcept {
+		return &*_value;
+	}
+
+	const T* operator->() const noexcept {
+		return &*_value;
+	}
+
+	const Error& error() const& noexcept {
+		return _error;
+	}
+
+	Error&& error() && noexcept {
+		return std::move(_error);
+	}
+
+private:
+	std::optional<T> _value;
+	Error            _error{};
+};
+
+#endif
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_EXPECTED_HPP__
@@ -2,11 +2,25 @@
 #define __SIMPLE_YAML_FIELD_HPP__
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include <pretty-name/pretty_name.hpp>
 #include <yaml-cpp/yaml.h>
 
+#include "Binding.hpp"
 #include "Deserializer.hpp"
+#include "Diagnostics.hpp"
+#include "Memory.hpp"
+#include "Regex.hpp"
+#include "Reload.hpp"
+#include "Trace.hpp"
+#include "TryDeserializer.hpp"
 
 namespace simple_yaml {
 
@@ -15,30 +29,81 @@ struct ValidatorFailed : RuntimeError {
 };
 
 template<typename T>
-concept deserializable_v = !std::is_same_v<void, decltype(Deserializer<T>::deserialize(YAML::Node{}, std::string{}))>;
+concept deserializable_v = !std::is_same_v<void, decltype(Deserializer<T>::deserialize(YAML::Node{}, Path{}))>;
+
+namespace detail {
+
+// A field of the type can stand in for a failed one while diagnostics are collected
+template<typename T, typename Default>
+concept recoverable_v = std::is_move_constructible_v<T> &&
+                        (!std::is_same_v<Default, void*> || std::is_default_constructible_v<T> || std::is_constructible_v<T, const YAML::Node&, const Path&>);
+
+} // namespace detail
 
 template<typename Default>
 struct Field {
-	Field(const ::YAML::Node& n, const std::string& path) : _data(n), _path(path) {
+	Field(const ::YAML::Node& n, const Path& path) : _data(n), _path(path) {
+	}
+
+	Field(stream::Binding& binding, std::string_view key, const Path& path) : _path(path), _binding(&binding), _key(key) {
 	}
 
 	template<typename T>
 	requires deserializable_v<T> T convertTo()
 	const {
-		if (!_data.IsDefined()) {
-			if constexpr (!std::is_same_v<Default, void*>) {
-				return _defaultValue;
+		static_assert(!std::is_same_v<T, std::string_view> || !std::is_same_v<Default, std::string>,
+		              "Default value of a std::string_view field must be a std::string_view");
+		if (_binding != nullptr) {
+			if (const auto* node = _binding->node(_key)) {
+				return Deserializer<T>::deserialize(*node, _path);
 			}
-			throw MissingNode("Missing node " + _path, _data.Mark());
+			if (auto value = _binding->template release<T>(_key)) {
+				return std::move(*value);
+			}
+		} else if (_data.IsDefined()) {
+			return Deserializer<T>::deserialize(_data, _path);
+		}
+
+		if constexpr (!std::is_same_v<Default, void*>) {
+			return detail::make<T>(_defaultValue);
 		}
-		return Deserializer<T>::deserialize(_data, _path);
+		throw MissingNode("Missing node " + _path, mark());
 	}
 
+	// Like convertTo, failures are returned instead of thrown
+	template<typename T>
+	requires tryDeserializable_v<T> Expected<T> tryConvertTo()
+	const {
+		if (_binding != nullptr) {
+			if (const auto* node = _binding->node(_key)) {
+				return TryDeserializer<T>::deserialize(*node, _path);
+			}
+			if (auto value = _binding->template release<T>(_key)) {
+				return std::move(*value);
+			}
+		} else if (_data.IsDefined()) {
+			return TryDeserializer<T>::deserialize(_data, _path);
+		}
+
+		if constexpr (!std::is_same_v<Default, void*>) {
+			return detail::make<T>(_defaultValue);
+		}
+		return Unexpected{Error{Error::Kind::MissingNode, _path, mark(), {}}};
+	}
+
+	// The node is converted only once, all rules then check the converted value
 	template<typename T>
 	requires deserializable_v<T>
 	operator T() {
-		validate();
-		return convertTo<T>();
+		if (_binding != nullptr && _binding->recording()) {
+			return record<T>();
+		}
+		if constexpr (detail::tracing) {
+			if (auto* tracer = Tracer::current(); tracer != nullptr) {
+				return traced<T>(*tracer);
+			}
+		}
+		return bindValue<T>();
 	}
 
 	template<typename... Args>
@@ -51,14 +116,24 @@ struct Field {
 		return *this;
 	}
 
+	// The predicate gets the value the field is converted to, a rule of a different type (e.g. a string rule on a path) converts
+	// the node on its own.
 	template<typename T>
-	Field& addRule(std::function<bool(T)> predicate, const std::string& errMsg = "") {
-		_rules.emplace_back([predicate, errMsg, this] {
-			T value = convertTo<T>();
-			if (!predicate(value)) {
-				throw ValidatorFailed(errMsg.empty() ? "Validation failed for " + _path : errMsg, _data.Mark());
-			}
-		});
+	Field& addRule(std::function<bool(const T&)> predicate, const std::string& errMsg = "") {
+		_rules.push_back({&typeid(T),
+		                  [predicate = std::move(predicate)](const Field& field, const void* value, const std::type_info& type) {
+			                  if (type == typeid(T)) {
+				                  return predicate(*static_cast<const T*>(value));
+			                  }
+			                  if constexpr (tryDeserializable_v<T>) {
+				                  if (detail::TryBind::failure() != nullptr) {
+					                  auto converted = field.template tryConvertTo<T>();
+					                  return converted.has_value() && predicate(*converted);
+				                  }
+			                  }
+			                  return predicate(field.template convertTo<T>());
+		                  },
+		                  errMsg});
 		return *this;
 	}
 
@@ -66,8 +141,20 @@ struct Field {
 		return addRule<std::string>([regex](const std::string& value) { return std::regex_match(value, regex); }, errMsg);
 	}
 
-	Field& addRuleRegex(std::string regex, const std::string& errMsg = "") {
-		return addRuleRegex(std::regex{regex}, errMsg);
+	// The pattern is compiled once per process, see RegexCache
+	Field& addRuleRegex(const std::string& regex, const std::string& errMsg = "") {
+		return addRuleRegex(regex, std::regex::ECMAScript, errMsg);
+	}
+
+	Field& addRuleRegex(const std::string& regex, std::regex::flag_type flags, const std::string& errMsg = "") {
+		auto compiled = RegexCache::get(regex, flags);
+		return addRule<std::string>([compiled](const std::string& value) { return std::regex_match(value, *compiled); }, errMsg);
+	}
+
+	// The pattern is compiled at compile time, e.g. `addRuleRegex<"^[a-z]+$">()`, see StaticRegex for the supported syntax
+	template<FixedString Pattern>
+	Field& addRuleRegex(const std::string& errMsg = "") {
+		return addRule<std::string>([](const std::string& value) { return StaticRegex<Pattern>::match(value); }, errMsg);
 	}
 
 	template<typename T>
@@ -97,17 +184,158 @@ struct Field {
 		return addRuleLength(std::numeric_limits<size_t>::min(), max, errMsg);
 	}
 
-	void validate() {
-		for (const auto& rule : _rules) {
-			rule();
+	template<typename T>
+	void validate(const T& value) const {
+		if (const auto* rule = failedRule(value)) {
+			throw ValidatorFailed(rule->message.empty() ? "Validation failed for " + _path : rule->message, mark());
 		}
 	}
 
 private:
-	YAML::Node                         _data;
-	std::string                        _path;
-	std::vector<std::function<void()>> _rules;
-	Default                            _defaultValue;
+	struct Rule {
+		const std::type_info*                                                  type;
+		std::function<bool(const Field&, const void*, const std::type_info&)> check;
+		std::string                                                            message;
+	};
+
+	template<typename T>
+	T bindValue() {
+		if constexpr (detail::recoverable_v<T, Default>) {
+			if (auto* failure = detail::TryBind::failure(); failure != nullptr) {
+				return tried<T>(*failure);
+			}
+			if (Diagnostics::current() != nullptr) {
+				return collected<T>();
+			}
+		}
+		if constexpr (std::is_copy_constructible_v<T>) {
+			// views of a Document cannot outlive it and copies would not be allocated from the Memory resource, so nothing is reused
+			// while binding with either
+			if (auto* reload = Reload::current(); reload != nullptr && _binding == nullptr && _data.IsDefined() && !Arena::active() && !Memory::active()) {
+				return reloaded<T>(*reload);
+			}
+		}
+		T value = convertTo<T>();
+		validate(value);
+		return value;
+	}
+
+	// Reports the field once it is bound, the counters of the field containing it are restored afterwards
+	template<typename T>
+	T traced(Tracer& tracer) {
+		const auto scalars    = detail::TraceCounters::scalars;
+		const auto validation = std::exchange(detail::TraceCounters::validation, std::chrono::nanoseconds{0});
+		const auto start      = std::chrono::steady_clock::now();
+		T          value      = bindValue<T>();
+		const auto elapsed    = std::chrono::steady_clock::now() - start;
+		tracer.field({_path, pretty_name::pretty_name<T>(), elapsed, std::exchange(detail::TraceCounters::validation, validation),
+		              detail::TraceCounters::scalars - scalars});
+		return value;
+	}
+
+	template<typename T>
+	const Rule* failedRule(const T& value) const {
+		if (_rules.empty()) {
+			return nullptr;
+		}
+		const detail::ValidationTimer timer;
+		for (const auto& rule : _rules) {
+			if (!rule.check(*this, &value, typeid(T))) {
+				return &rule;
+			}
+		}
+		return nullptr;
+	}
+
+	// Records the first failure of the structure bound by Simple::tryBind, once there is one fields only produce placeholders
+	template<typename T>
+	T tried(std::optional<Error>& failure) {
+		if (failure.has_value()) {
+			return fallback<T>();
+		}
+		if constexpr (tryDeserializable_v<T>) {
+			auto value = tryConvertTo<T>();
+			if (!value) {
+				failure = std::move(value).error();
+				return fallback<T>();
+			}
+			if (const auto* rule = failedRule(*value)) {
+				failure = Error{Error::Kind::ValidationFailed, _path, mark(), rule->message};
+				return fallback<T>();
+			}
+			return std::move(*value);
+		} else {
+			// types without a TryDeserializer are converted the regular way
+			T value = convertTo<T>();
+			validate(value);
+			return value;
+		}
+	}
+
+	// Registers the field in the schema of the structure, rules are not checked on the placeholder value
+	template<typename T>
+	T record() {
+		_binding->template record<T>(_key);
+		for (const auto& rule : _rules) {
+			if (*rule.type != typeid(T)) {
+				_binding->capture(_key);
+			}
+		}
+		return stream::placeholder<T>();
+	}
+
+	// Failures are recorded, the field falls back to its default value or a placeholder, a failed rule keeps the converted value
+	template<typename T>
+	T collected() {
+		std::optional<T> value;
+		if (!Diagnostics::attempt(_path, mark(), [&] { value.emplace(convertTo<T>()); })) {
+			return fallback<T>();
+		}
+		Diagnostics::attempt(_path, mark(), [&] { validate(*value); });
+		return std::move(*value);
+	}
+
+	template<typename T>
+	T fallback() const {
+		if constexpr (!std::is_same_v<Default, void*>) {
+			return detail::make<T>(_defaultValue);
+		} else if constexpr (std::is_default_constructible_v<T>) {
+			return T{};
+		} else {
+			// failures of the placeholder are not reported
+			Diagnostics              ignored;
+			const Diagnostics::Scope scope{&ignored};
+			return T{YAML::Node{YAML::NodeType::Map}, _path};
+		}
+	}
+
+	template<typename T>
+	T reloaded(Reload& reload) {
+		const auto key  = Reload::keyOf<T>(_path);
+		const auto hash = fingerprint(_data);
+		if (auto value = reload.template reuse<T>(key, hash)) {
+			return std::move(*value);
+		}
+		const Reload::Nested nested{reload, key};
+		T                    value = convertTo<T>();
+		validate(value);
+		reload.store(key, nested.outer(), hash, value);
+		return value;
+	}
+
+	YAML::Mark mark() const {
+		if (_binding != nullptr) {
+			return _binding->mark();
+		}
+		return _data.IsDefined() ? _data.Mark() : YAML::Mark::null_mark();
+	}
+
+	YAML::Node        _data;
+	Path              _path;
+	std::vector<Rule> _rules;
+	Default           _defaultValue;
+	stream::Binding*  _binding{nullptr};
+	std::string_view  _key;
 };
 
 } // namespace simple_yaml
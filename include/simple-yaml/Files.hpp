@@ -0,0 +1,121 @@
+#ifndef __SIMPLE_YAML_FILES_HPP__
+#define __SIMPLE_YAML_FILES_HPP__
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Field.hpp"
+#include "Path.hpp"
+#include "Simple.hpp"
+#include "ThreadPool.hpp"
+
+namespace simple_yaml {
+
+// Result of loading one of several files, either the value or the exception loading it threw
+template<typename T>
+class Loaded {
+public:
+	explicit Loaded(std::string path) : _path(std::move(path)) {
+	}
+
+	const std::string& path() const {
+		return _path;
+	}
+
+	bool ok() const {
+		return _value.has_value();
+	}
+
+	explicit operator bool() const {
+		return ok();
+	}
+
+	// Rethrows the error of the file if it failed
+	T& value() {
+		rethrow();
+		return *_value;
+	}
+
+	const T& value() const {
+		rethrow();
+		return *_value;
+	}
+
+	std::exception_ptr error() const {
+		return _error;
+	}
+
+	template<typename Load>
+	void load(Load&& load) {
+		try {
+			_value.emplace(load(_path));
+		} catch (...) {
+			_error = std::current_exception();
+		}
+	}
+
+private:
+	void rethrow() const {
+		if (_error) {
+			std::rethrow_exception(_error);
+		}
+	}
+
+	std::string        _path;
+	std::optional<T>   _value;
+	std::exception_ptr _error;
+};
+
+namespace detail {
+
+template<typename T, typename Load>
+std::vector<Loaded<T>> loadEach(const std::vector<std::string>& paths, ThreadPool& pool, Load&& load) {
+	std::vector<Loaded<T>> results;
+	results.reserve(paths.size());
+	for (const auto& path : paths) {
+		results.emplace_back(path);
+	}
+	pool.forEach(results.size(), [&](std::size_t i) { results[i].load(load); });
+	return results;
+}
+
+inline std::size_t threadsFor(std::size_t files) {
+	return std::min<std::size_t>(files, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+} // namespace detail
+
+// Parses the files concurrently on the pool, results are in the order of `paths` and a failed file does not stop the others
+inline std::vector<Loaded<YAML::Node>> fromFiles(const std::vector<std::string>& paths, ThreadPool& pool) {
+	return detail::loadEach<YAML::Node>(paths, pool, [](const std::string& path) { return fromFile(path); });
+}
+
+// Uses a pool of at most one thread per file and hardware thread
+inline std::vector<Loaded<YAML::Node>> fromFiles(const std::vector<std::string>& paths) {
+	ThreadPool pool{detail::threadsFor(paths.size())};
+	return fromFiles(paths, pool);
+}
+
+// Parses and binds the files concurrently on the pool, error paths start with the file name
+template<typename T>
+requires deserializable_v<T> std::vector<Loaded<T>> loadAll(const std::vector<std::string>& paths, ThreadPool& pool) {
+	return detail::loadEach<T>(paths, pool, [](const std::string& path) { return Deserializer<T>::deserialize(fromFile(path), Path{path}); });
+}
+
+template<typename T>
+requires deserializable_v<T> std::vector<Loaded<T>> loadAll(const std::vector<std::string>& paths) {
+	ThreadPool pool{detail::threadsFor(paths.size())};
+	return loadAll<T>(paths, pool);
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_FILES_HPP__
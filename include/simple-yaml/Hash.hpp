@@ -0,0 +1,21 @@
+#ifndef __SIMPLE_YAML_HASH_HPP__
+#define __SIMPLE_YAML_HASH_HPP__
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace simple_yaml {
+
+// 64-bit FNV-1a, unlike std::hash it is the same on every platform and run, so it can key data stored on disk
+constexpr std::uint64_t fnv1a(std::string_view data, std::uint64_t hash = 14695981039346656037ull) {
+	for (const char c : data) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_HASH_HPP__
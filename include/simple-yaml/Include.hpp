@@ -0,0 +1,235 @@
+#ifndef __SIMPLE_YAML_INCLUDE_HPP__
+#define __SIMPLE_YAML_INCLUDE_HPP__
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Exception.hpp"
+#include "Hash.hpp"
+#include "MappedFile.hpp"
+
+namespace simple_yaml {
+
+// Fragments pulled into documents by `!include <file>` scalars, e.g. `catalogue: !include shared/catalogue.yaml`.
+//
+// The scalar is replaced by the root of the fragment. Relative file names are resolved against the directory of the including
+// file, fragments may include others. Each fragment is parsed once and kept by its canonical path, as long as the modification
+// time and size of its file and of the files it includes are unchanged. A file that was only touched (same content hash) is not
+// parsed again either. Documents get their own copy of the fragment, yaml-cpp would otherwise tie their memory together, so
+// they can be modified and bound on different threads. Copying a fragment costs about half of parsing it.
+//
+// The cache is thread-safe. `Includes::shared()` is used by fromFile, fromMappedFile, fromFiles, loadAll and Document::fromFile.
+class Includes {
+public:
+	static constexpr std::string_view tag = "!include";
+
+	Includes()                           = default;
+	Includes(const Includes&)            = delete;
+	Includes& operator=(const Includes&) = delete;
+
+	// Cache of the process
+	static Includes& shared() {
+		static Includes includes;
+		return includes;
+	}
+
+	// Parses the file and resolves its includes
+	YAML::Node fromFile(const std::string& filename) {
+		auto root = YAML::LoadFile(filename);
+		resolve(root, std::filesystem::path{filename}.parent_path());
+		return root;
+	}
+
+	// Parses the text and resolves its includes relative to `directory`, the text is only searched when it mentions the tag
+	YAML::Node parse(std::string_view text, const std::filesystem::path& directory) {
+		MemoryStream is{text};
+		YAML::Node   root = YAML::Load(is);
+		if (text.find(tag) != std::string_view::npos) {
+			resolve(root, directory);
+		}
+		return root;
+	}
+
+	// Replaces every `!include` scalar of the tree by a copy of its fragment
+	void resolve(YAML::Node& root, const std::filesystem::path& directory) {
+		Dependencies ignored;
+		resolve(root, directory, ignored);
+	}
+
+	// Fragments parsed and fragments taken from the cache
+	std::size_t misses() const {
+		const std::lock_guard lock{_mutex};
+		return _misses;
+	}
+
+	std::size_t hits() const {
+		const std::lock_guard lock{_mutex};
+		return _hits;
+	}
+
+	std::size_t size() const {
+		const std::lock_guard lock{_mutex};
+		return _entries.size();
+	}
+
+	void clear() {
+		const std::lock_guard lock{_mutex};
+		_entries.clear();
+	}
+
+private:
+	struct Stamp {
+		std::filesystem::file_time_type modified;
+		std::uintmax_t                  size{0};
+
+		bool operator==(const Stamp&) const = default;
+	};
+
+	using Dependencies = std::vector<std::pair<std::string, Stamp>>;
+
+	struct Entry {
+		Stamp         stamp;
+		std::uint64_t hash{0};
+		YAML::Node    fragment;     // never modified once cached, copies are read concurrently
+		Dependencies  dependencies; // every file included directly or not
+	};
+
+	// Files whose fragments are being parsed on this thread, to detect include cycles
+	static inline thread_local std::vector<std::string> _loading;
+
+	static std::optional<Stamp> stampOf(const std::string& file) {
+		std::error_code ec;
+		const auto      modified = std::filesystem::last_write_time(file, ec);
+		if (ec) {
+			return std::nullopt;
+		}
+		const auto size = std::filesystem::file_size(file, ec);
+		if (ec) {
+			return std::nullopt;
+		}
+		return Stamp{modified, size};
+	}
+
+	void resolve(YAML::Node& node, const std::filesystem::path& directory, Dependencies& dependencies) {
+		switch (node.Type()) {
+			case YAML::NodeType::Scalar:
+				if (node.Tag() == tag) {
+					auto included = include(node, directory, dependencies);
+					// assignment writes through to the entry of the parent
+					node = included;
+				}
+				break;
+			case YAML::NodeType::Sequence:
+				for (auto element : node) {
+					resolve(element, directory, dependencies);
+				}
+				break;
+			case YAML::NodeType::Map:
+				for (auto it = node.begin(); it != node.end(); ++it) {
+					YAML::Node value = it->second;
+					resolve(value, directory, dependencies);
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	YAML::Node include(const YAML::Node& node, const std::filesystem::path& directory, Dependencies& dependencies) {
+		std::error_code ec;
+		const auto      file = std::filesystem::weakly_canonical(directory / node.Scalar(), ec).string();
+		if (ec) {
+			throw YAML::BadFile(node.Scalar());
+		}
+		if (std::find(_loading.begin(), _loading.end(), file) != _loading.end()) {
+			throw InvalidNode("Include cycle through " + file, node.Mark());
+		}
+		auto entry = load(file);
+		dependencies.emplace_back(file, entry->stamp);
+		dependencies.insert(dependencies.end(), entry->dependencies.begin(), entry->dependencies.end());
+		return YAML::Clone(entry->fragment);
+	}
+
+	std::shared_ptr<const Entry> load(const std::string& file) {
+		const auto found = stampOf(file);
+		if (!found) {
+			throw YAML::BadFile(file);
+		}
+		const auto stamp = *found;
+		{
+			const std::lock_guard lock{_mutex};
+			if (auto it = _entries.find(file); it != _entries.end() && it->second->stamp == stamp && current(*it->second)) {
+				++_hits;
+				return it->second;
+			}
+		}
+
+		const MappedFile source{file};
+		const auto       hash = fnv1a(source.view());
+		{
+			const std::lock_guard lock{_mutex};
+			if (auto it = _entries.find(file); it != _entries.end() && it->second->hash == hash && current(*it->second)) {
+				auto touched   = std::make_shared<Entry>(*it->second);
+				touched->stamp = stamp;
+				it->second     = touched;
+				++_hits;
+				return touched;
+			}
+		}
+
+		// parsed without holding the lock, two threads may parse the same new fragment and the last one is kept
+		auto entry = std::make_shared<Entry>();
+		{
+			_loading.push_back(file);
+			struct Loaded {
+				~Loaded() {
+					_loading.pop_back();
+				}
+			} loaded;
+			MemoryStream is{source.view()};
+			entry->fragment = YAML::Load(is);
+			if (source.view().find(tag) != std::string_view::npos) {
+				resolve(entry->fragment, std::filesystem::path{file}.parent_path(), entry->dependencies);
+			}
+		}
+		auto& dependencies = entry->dependencies;
+		std::sort(dependencies.begin(), dependencies.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		dependencies.erase(std::unique(dependencies.begin(), dependencies.end(), [](const auto& a, const auto& b) { return a.first == b.first; }),
+		                   dependencies.end());
+		entry->stamp = stamp;
+		entry->hash  = hash;
+
+		const std::lock_guard lock{_mutex};
+		++_misses;
+		_entries.insert_or_assign(file, entry);
+		return entry;
+	}
+
+	// Files the fragment includes are unchanged
+	static bool current(const Entry& entry) {
+		return std::all_of(entry.dependencies.begin(), entry.dependencies.end(),
+		                   [](const auto& dependency) { return stampOf(dependency.first) == dependency.second; });
+	}
+
+	mutable std::mutex                                            _mutex;
+	std::unordered_map<std::string, std::shared_ptr<const Entry>> _entries;
+	std::size_t                                                   _hits{0};
+	std::size_t                                                   _misses{0};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_INCLUDE_HPP__
@@ -0,0 +1,35 @@
+#ifndef __SIMPLE_YAML_INSTANTIATIONS_HPP__
+#define __SIMPLE_YAML_INSTANTIATIONS_HPP__
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Field.hpp"
+
+// Field types most configurations use. The simple_yaml library target instantiates their deserializers and fields once, with
+// SIMPLE_YAML_PRECOMPILED translation units including the headers only declare them (and keep them for inlining when optimizing).
+#define SIMPLE_YAML_COMMON_TYPES(X)                                                                                \
+	X(bool) X(int) X(unsigned int) X(long) X(unsigned long) X(long long) X(unsigned long long) X(float) X(double)  \
+	X(std::string) X(std::filesystem::path) X(std::vector<int>) X(std::vector<double>) X(std::vector<std::string>) \
+	X(std::chrono::nanoseconds) X(std::chrono::microseconds) X(std::chrono::milliseconds) X(std::chrono::seconds)  \
+	X(std::chrono::minutes) X(std::chrono::hours)
+
+// A field of type T with and without a default value
+#define SIMPLE_YAML_INSTANTIATE(T)                    \
+	template struct simple_yaml::Deserializer<T>;     \
+	template simple_yaml::Field<void*>::operator T(); \
+	template simple_yaml::Field<T>::operator T();
+
+#define SIMPLE_YAML_EXTERN(T)                                \
+	extern template struct simple_yaml::Deserializer<T>;     \
+	extern template simple_yaml::Field<void*>::operator T(); \
+	extern template simple_yaml::Field<T>::operator T();
+
+#ifdef SIMPLE_YAML_PRECOMPILED
+SIMPLE_YAML_COMMON_TYPES(SIMPLE_YAML_EXTERN)
+#endif
+
+#endif // __SIMPLE_YAML_INSTANTIATIONS_HPP__
@@ -0,0 +1,89 @@
+#ifndef __SIMPLE_YAML_KEYED_HPP__
+#define __SIMPLE_YAML_KEYED_HPP__
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <yaml-cpp/yaml.h>
+
+#include "Binding.hpp"
+#include "Path.hpp"
+#include "PerfectHash.hpp"
+#include "Regex.hpp"
+#include "Simple.hpp"
+
+namespace simple_yaml {
+
+// Nodes of the declared keys of a mapping, found in a single pass over its entries.
+//
+// It is created from the node when a Keyed structure is constructed and lives until the end of that full-expression, which covers
+// the initialization of all fields of the structure.
+template<FixedString... Keys>
+class KeyIndex {
+public:
+	KeyIndex(const YAML::Node& n) : _node(n) {
+		if (!n.IsMap()) {
+			return;
+		}
+		_mapped = true;
+		for (auto it = n.begin(); it != n.end(); ++it) {
+			if (!it->first.IsScalar()) {
+				continue;
+			}
+			// the first of duplicate keys wins, like in a lookup
+			const auto i = table.find(it->first.Scalar());
+			if (i != table.npos && !_nodes[i]) {
+				_nodes[i].emplace(it->second);
+			}
+		}
+	}
+
+	KeyIndex(const KeyIndex&)            = delete;
+	KeyIndex& operator=(const KeyIndex&) = delete;
+
+	const YAML::Node& node() const {
+		return _node;
+	}
+
+	detail::KeyLookup lookup() const {
+		return {this, &KeyIndex::find};
+	}
+
+private:
+	static const YAML::Node* find(const void* self, std::string_view key) {
+		const auto& index = *static_cast<const KeyIndex*>(self);
+		const auto  i     = table.find(key);
+		if (!index._mapped || i == table.npos) {
+			return nullptr;
+		}
+		if (!index._nodes[i]) {
+			static const YAML::Node missing{YAML::NodeType::Undefined};
+			return &missing;
+		}
+		return &*index._nodes[i];
+	}
+
+	static constexpr detail::PerfectHash<sizeof...(Keys)> table{{Keys.view()...}};
+
+	const YAML::Node&                                      _node;
+	std::array<std::optional<YAML::Node>, sizeof...(Keys)> _nodes;
+	bool                                                   _mapped{false};
+};
+
+// Base of structures which declare their keys at compile time, e.g. `struct Server : Keyed<"host", "port"> { using Keyed::Keyed; ...}`.
+//
+// Plain Simple structures look every field up in the mapping, which scans its entries one by one. A Keyed structure walks the
+// mapping once and finds the node of every declared key through a perfect hash, so wide records cost O(keys + fields) instead of
+// O(keys * fields). Fields with keys that are not declared are looked up the regular way.
+template<FixedString... Keys>
+struct Keyed : Simple {
+	Keyed(KeyIndex<Keys...>&& index, const Path& path = {}) : Simple(index.node(), path, index.lookup()) {
+	}
+	Keyed(stream::Binding& binding) : Simple(binding) {
+	}
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_KEYED_HPP__
@@ -0,0 +1,156 @@
+#ifndef __SIMPLE_YAML_MAPPED_FILE_HPP__
+#define __SIMPLE_YAML_MAPPED_FILE_HPP__
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <yaml-cpp/yaml.h>
+
+#ifdef _WIN32
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace simple_yaml {
+
+// Read-only memory mapping of a whole file, throws YAML::BadFile like YAML::LoadFile when the file cannot be mapped
+class MappedFile {
+public:
+	explicit MappedFile(const std::string& filename) {
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			throw YAML::BadFile(filename);
+		}
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			throw YAML::BadFile(filename);
+		}
+		_size = static_cast<std::size_t>(size.QuadPart);
+		if (_size != 0) {
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			_data          = mapping != nullptr ? static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+			if (mapping != nullptr) {
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+#else
+		const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			throw YAML::BadFile(filename);
+		}
+		struct stat st {};
+		if (::fstat(fd, &st) != 0) {
+			::close(fd);
+			throw YAML::BadFile(filename);
+		}
+		_size = static_cast<std::size_t>(st.st_size);
+		if (_size != 0) {
+			void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED) {
+				::madvise(data, _size, MADV_SEQUENTIAL);
+				_data = static_cast<const char*>(data);
+			}
+		}
+		::close(fd);
+#endif
+		if (_size != 0 && _data == nullptr) {
+			throw YAML::BadFile(filename);
+		}
+	}
+
+	MappedFile(const MappedFile&)            = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {
+	}
+
+	MappedFile& operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			_data = std::exchange(other._data, nullptr);
+			_size = std::exchange(other._size, 0);
+		}
+		return *this;
+	}
+
+	~MappedFile() {
+		unmap();
+	}
+
+	std::string_view view() const {
+		return {_data != nullptr ? _data : "", _size};
+	}
+
+	std::size_t size() const {
+		return _size;
+	}
+
+private:
+	void unmap() {
+		if (_data == nullptr) {
+			return;
+		}
+#ifdef _WIN32
+		UnmapViewOfFile(_data);
+#else
+		::munmap(const_cast<char*>(_data), _size);
+#endif
+		_data = nullptr;
+	}
+
+	const char* _data{nullptr};
+	std::size_t _size{0};
+};
+
+// Stream buffer over memory owned by someone else, nothing is copied
+class MemoryBuffer : public std::streambuf {
+public:
+	explicit MemoryBuffer(std::string_view data) {
+		char* begin = const_cast<char*>(data.data());
+		setg(begin, begin, begin + data.size());
+	}
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+		const off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : egptr() - eback();
+		return seekpos(pos_type(base + off), which);
+	}
+
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+		const off_type offset = pos;
+		if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback()) {
+			return pos_type(off_type(-1));
+		}
+		setg(eback(), eback() + offset, egptr());
+		return pos;
+	}
+};
+
+// Input stream reading straight from memory, the parser consumes a mapping without an intermediate file buffer
+class MemoryStream : public std::istream {
+public:
+	explicit MemoryStream(std::string_view data) : std::istream(nullptr), _buffer(data) {
+		rdbuf(&_buffer);
+	}
+
+private:
+	MemoryBuffer _buffer;
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_MAPPED_FILE_HPP__
@@ -0,0 +1,63 @@
+#ifndef __SIMPLE_YAML_MEMORY_HPP__
+#define __SIMPLE_YAML_MEMORY_HPP__
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace simple_yaml {
+
+// Memory resource the std::pmr strings and containers being bound allocate from.
+//
+// While a Memory::Scope is alive on the binding thread, deserializers construct values taking a std::pmr::polymorphic_allocator
+// (std::pmr::string, std::pmr::vector, the std::pmr associative containers, nested in any way) with the resource, default values
+// of fields included. Other types are not affected. A std::pmr::monotonic_buffer_resource per configuration then builds it with
+// a few large allocations and frees it at once. The resource is not synchronized, so containers are deserialized serially and
+// fields are not reused from a Reload, whose copies would not be allocated from it.
+class Memory {
+public:
+	class Scope {
+	public:
+		explicit Scope(std::pmr::memory_resource& resource) : _previous(std::exchange(_current, &resource)) {
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_current = _previous;
+		}
+
+	private:
+		std::pmr::memory_resource* _previous;
+	};
+
+	static bool active() {
+		return _current != nullptr;
+	}
+
+	static std::pmr::polymorphic_allocator<> allocator() {
+		return {_current != nullptr ? _current : std::pmr::get_default_resource()};
+	}
+
+private:
+	static inline thread_local std::pmr::memory_resource* _current{nullptr};
+};
+
+namespace detail {
+
+// Constructs a deserialized value, with the allocator of the active Memory::Scope when T uses one
+template<typename T, typename... Args>
+T make(Args&&... args) {
+	if (Memory::active()) {
+		return std::make_obj_using_allocator<T>(Memory::allocator(), std::forward<Args>(args)...);
+	}
+	return T(std::forward<Args>(args)...);
+}
+
+} // namespace detail
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_MEMORY_HPP__
@@ -0,0 +1,156 @@
+#ifndef __SIMPLE_YAML_NUMBER_HPP__
+#define __SIMPLE_YAML_NUMBER_HPP__
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace simple_yaml {
+
+namespace detail {
+
+// Arithmetic types spelled as numbers, characters and bool have spellings of their own
+template<typename T>
+inline constexpr bool isNumber = (std::is_integral_v<T> || std::is_floating_point_v<T>) && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+                                 !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> &&
+                                 !std::is_same_v<T, char8_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+enum class Conversion { Ok, Invalid, OutOfRange };
+
+// Integer of the YAML 1.2 core schema: `[-+]?[0-9]+`, `0o[0-7]+` or `0x[0-9a-fA-F]+`
+template<typename T>
+requires isNumber<T> && std::is_integral_v<T> Conversion parseNumber(std::string_view text, T& out) {
+	bool negative = false;
+	int  base     = 10;
+	if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'o')) {
+		base = text[1] == 'x' ? 16 : 8;
+		text.remove_prefix(2);
+	} else if (!text.empty() && (text[0] == '-' || text[0] == '+')) {
+		negative = text[0] == '-';
+		text.remove_prefix(1);
+	}
+	// from_chars would take another sign
+	if (text.empty() || text[0] == '-' || text[0] == '+') {
+		return Conversion::Invalid;
+	}
+
+	std::uintmax_t magnitude;
+	const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), magnitude, base);
+	if (ptr != text.data() + text.size() || (ec != std::errc() && ec != std::errc::result_out_of_range)) {
+		return Conversion::Invalid;
+	}
+	if (ec == std::errc::result_out_of_range) {
+		return Conversion::OutOfRange;
+	}
+
+	using Unsigned = std::make_unsigned_t<T>;
+	if (!negative) {
+		if (magnitude > static_cast<Unsigned>(std::numeric_limits<T>::max())) {
+			return Conversion::OutOfRange;
+		}
+		out = static_cast<T>(magnitude);
+		return Conversion::Ok;
+	}
+	if constexpr (std::is_unsigned_v<T>) {
+		if (magnitude != 0) {
+			return Conversion::OutOfRange;
+		}
+		out = 0;
+	} else {
+		// |min| is max + 1, computed without overflowing
+		if (magnitude > static_cast<Unsigned>(std::numeric_limits<T>::max()) + 1u) {
+			return Conversion::OutOfRange;
+		}
+		out = static_cast<T>(0 - static_cast<Unsigned>(magnitude));
+	}
+	return Conversion::Ok;
+}
+
+// Float of the YAML 1.2 core schema: decimal with an optional exponent, `.inf`, `.nan` in the three cases, or any integer
+template<typename T>
+requires std::is_floating_point_v<T> Conversion parseNumber(std::string_view text, T& out) {
+	const bool       negative = !text.empty() && text[0] == '-';
+	std::string_view digits   = !text.empty() && (text[0] == '-' || text[0] == '+') ? text.substr(1) : text;
+
+	if (digits == ".inf" || digits == ".Inf" || digits == ".INF") {
+		out = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+		return Conversion::Ok;
+	}
+	if (text == ".nan" || text == ".NaN" || text == ".NAN") {
+		out = std::numeric_limits<T>::quiet_NaN();
+		return Conversion::Ok;
+	}
+	if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'o')) {
+		std::uintmax_t value;
+		const auto     result = parseNumber(text, value);
+		if (result == Conversion::Ok) {
+			out = static_cast<T>(value);
+		}
+		return result;
+	}
+
+	// from_chars also takes `inf`, `nan` and another sign, which are not numbers in YAML
+	if (digits.empty() || !((digits[0] >= '0' && digits[0] <= '9') || digits[0] == '.')) {
+		return Conversion::Invalid;
+	}
+	const char* first    = negative ? text.data() : digits.data();
+	const char* last     = text.data() + text.size();
+	const auto [ptr, ec] = std::from_chars(first, last, out);
+	if (ptr != last) {
+		return Conversion::Invalid;
+	}
+	if (ec == std::errc::result_out_of_range) {
+		return Conversion::OutOfRange;
+	}
+	return ec == std::errc() ? Conversion::Ok : Conversion::Invalid;
+}
+
+// Bool of the YAML 1.2 core schema, the YAML 1.1 `y`, `yes`, `on`, `n`, `no` and `off` are still accepted as yaml-cpp does.
+// Every literal is taken in lower case, upper case or capitalized.
+inline Conversion parseBool(std::string_view text, bool& out) {
+	constexpr std::string_view truths[]    = {"true", "y", "yes", "on"};
+	constexpr std::string_view falsities[] = {"false", "n", "no", "off"};
+
+	if (text.empty() || text.size() > 5) {
+		return Conversion::Invalid;
+	}
+	const auto upper = [](char c) { return c >= 'A' && c <= 'Z'; };
+	const auto lower = [](char c) { return c >= 'a' && c <= 'z'; };
+
+	char lowered[5];
+	bool allUpper = true;
+	bool allLower = true;
+	for (std::size_t i = 0; i < text.size(); ++i) {
+		allUpper   = allUpper && upper(text[i]);
+		allLower   = allLower && (lower(text[i]) || (i == 0 && upper(text[i])));
+		lowered[i] = upper(text[i]) ? static_cast<char>(text[i] - 'A' + 'a') : text[i];
+	}
+	if (!allUpper && !allLower) {
+		return Conversion::Invalid;
+	}
+
+	const std::string_view literal{lowered, text.size()};
+	for (const auto truth : truths) {
+		if (literal == truth) {
+			out = true;
+			return Conversion::Ok;
+		}
+	}
+	for (const auto falsity : falsities) {
+		if (literal == falsity) {
+			out = false;
+			return Conversion::Ok;
+		}
+	}
+	return Conversion::Invalid;
+}
+
+} // namespace detail
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_NUMBER_HPP__
@@ -0,0 +1,90 @@
+#ifndef __SIMPLE_YAML_PARALLEL_HPP__
+#define __SIMPLE_YAML_PARALLEL_HPP__
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "Arena.hpp"
+#include "Memory.hpp"
+#include "Detach.hpp"
+#include "ThreadPool.hpp"
+
+namespace simple_yaml {
+
+// Opt-in parallel deserialization of large sequences and maps.
+//
+// While a Parallel::Scope is alive, deserializers of std::vector and associative containers with at least `minimumEntries`
+// entries split the entries across the pool, the calling thread takes part too. Results keep the order of the serial path and
+// when several entries fail, the exception of the lowest index is rethrown. Entries are deserialized serially inside, and so are
+// documents bound with an active Arena (std::string_view, std::span) or Memory::Scope. An active Detach::Scope applies on the pool too.
+class Parallel {
+public:
+	class Scope;
+
+	// Context to deserialize a container of `entries` entries with, null when it should be deserialized serially
+	static const Parallel* worth(std::size_t entries) {
+		if (_current == nullptr || entries < _current->_minimumEntries || Arena::active() || Memory::active()) {
+			return nullptr;
+		}
+		return _current;
+	}
+
+	// Calls `body(i)` for every `i < count`, stops early past a failed index
+	template<typename Body>
+	void forEach(std::size_t count, Body&& body) const {
+		const std::size_t grain = std::max<std::size_t>(1, count / (8 * (_pool->size() + 1)));
+		_pool->forEach(
+		    count,
+		    [&body, detach = Detach::active()](std::size_t i) {
+			    const Suspend       suspend;
+			    const Detach::Scope scope{detach};
+			    body(i);
+		    },
+		    grain);
+	}
+
+private:
+	// Entries are deserialized serially, also when the calling thread takes part
+	struct Suspend {
+		Suspend() : outer(std::exchange(_current, nullptr)) {
+		}
+
+		~Suspend() {
+			_current = outer;
+		}
+
+		const Parallel* outer;
+	};
+
+	Parallel(ThreadPool& pool, std::size_t minimumEntries) : _pool(&pool), _minimumEntries(minimumEntries) {
+	}
+
+	ThreadPool* _pool;
+	std::size_t _minimumEntries;
+
+	static inline thread_local const Parallel* _current{nullptr};
+};
+
+class Parallel::Scope {
+public:
+	explicit Scope(ThreadPool& pool, std::size_t minimumEntries = 1024) : _parallel(pool, minimumEntries), _previous(_current) {
+		_current = &_parallel;
+	}
+
+	Scope(const Scope&)            = delete;
+	Scope& operator=(const Scope&) = delete;
+
+	~Scope() {
+		_current = _previous;
+	}
+
+private:
+	Parallel        _parallel;
+	const Parallel* _previous;
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_PARALLEL_HPP__
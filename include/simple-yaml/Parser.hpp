@@ -2,51 +2,178 @@
 #define __SIMPLE_YAML_PARSER_HPP__
 #pragma once
 
+#include <array>
+#include <charconv>
 #include <chrono>
-#include <regex>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <string>
 #include <string_view>
-#include <unordered_map>
+#include <type_traits>
+
+#include "Number.hpp"
 
 namespace simple_yaml {
 
+// Parses durations such as `1d 2h 30m 10s` or `-5ms`.
+//
+// The input is scanned in place, every component is a (possibly negative) integer immediately followed by a unit. Components
+// may be separated by whitespace. Integral results are checked for overflow.
 template<typename Duration>
 class DurationParser {
-	template<typename ParseDuration>
-	static constexpr std::function<Duration(int64_t)> makeConverter() {
-		return [](int64_t i) { return std::chrono::duration_cast<Duration>(ParseDuration{i}); };
+	using Rep = typename Duration::rep;
+
+	struct Unit {
+		std::string_view name;
+		std::intmax_t    num; // conversion factor from the unit to `Duration`
+		std::intmax_t    den;
+	};
+
+	template<typename Period>
+	static constexpr Unit unit(std::string_view name) {
+		using Factor = std::ratio_divide<Period, typename Duration::period>;
+		return {name, Factor::num, Factor::den};
+	}
+
+	static constexpr std::array units{
+	    unit<std::chrono::nanoseconds::period>("ns"),
+	    unit<std::chrono::microseconds::period>("us"),
+	    unit<std::chrono::milliseconds::period>("ms"),
+	    unit<std::chrono::seconds::period>("s"),
+	    unit<std::chrono::minutes::period>("m"),
+	    unit<std::chrono::hours::period>("h"),
+	    unit<std::chrono::days::period>("d"),
+	    unit<std::chrono::weeks::period>("w"),
+	    unit<std::chrono::months::period>("M"),
+	    unit<std::chrono::months::period>("mo"),
+	    unit<std::chrono::years::period>("y"),
+	};
+
+	static constexpr bool isSpace(char c) {
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+	static constexpr bool isAlpha(char c) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+	}
+
+	static constexpr const Unit* findUnit(std::string_view name) {
+		for (const auto& u : units) {
+			if (u.name == name) {
+				return &u;
+			}
+		}
+		return nullptr;
+	}
+
+	// Results of a scan, mapped to exceptions by parse() and to a Conversion by tryParse()
+	enum class Status { Ok, Invalid, UnknownUnit, Overflow };
+
+	static bool convert(std::intmax_t value, const Unit& u, Rep& result) {
+		if constexpr (std::is_floating_point_v<Rep>) {
+			result = static_cast<Rep>(value) * static_cast<Rep>(u.num) / static_cast<Rep>(u.den);
+			return true;
+		} else {
+			constexpr auto max = std::numeric_limits<std::intmax_t>::max();
+			constexpr auto min = std::numeric_limits<std::intmax_t>::min();
+			if (u.num != 1 && (value > max / u.num || value < min / u.num)) {
+				return false;
+			}
+			const auto converted = value * u.num / u.den;
+			if (converted > std::numeric_limits<Rep>::max() || converted < std::numeric_limits<Rep>::min()) {
+				return false;
+			}
+			result = static_cast<Rep>(converted);
+			return true;
+		}
+	}
+
+	static bool add(Rep& total, Rep value) {
+		if constexpr (!std::is_floating_point_v<Rep>) {
+			if ((value > 0 && total > std::numeric_limits<Rep>::max() - value) || (value < 0 && total < std::numeric_limits<Rep>::min() - value)) {
+				return false;
+			}
+		}
+		total += value;
+		return true;
+	}
+
+	// `unit` is set to the name of an unknown unit
+	static Status scan(std::string_view str, Rep& total, std::string_view& unit) {
+		const char* it  = str.data();
+		const char* end = str.data() + str.size();
+		total           = Rep{0};
+
+		while (true) {
+			while (it != end && isSpace(*it)) {
+				++it;
+			}
+			if (it == end) {
+				break;
+			}
+
+			std::intmax_t value;
+			auto [ptr, ec] = std::from_chars(it, end, value);
+			if (ec == std::errc::result_out_of_range) {
+				return Status::Overflow;
+			}
+			if (ec != std::errc()) {
+				return Status::Invalid;
+			}
+
+			const char* unitBegin = ptr;
+			while (ptr != end && isAlpha(*ptr)) {
+				++ptr;
+			}
+			unit          = {unitBegin, static_cast<size_t>(ptr - unitBegin)};
+			const Unit* u = findUnit(unit);
+			if (u == nullptr) {
+				return Status::UnknownUnit;
+			}
+
+			Rep converted;
+			if (!convert(value, *u, converted) || !add(total, converted)) {
+				return Status::Overflow;
+			}
+			it = ptr;
+		}
+		return Status::Ok;
 	}
 
 public:
-	static Duration parse(std::string str) {
-		static std::unordered_map<std::string_view, std::function<Duration(int64_t)>> converters{
-		    {"ns", makeConverter<std::chrono::nanoseconds>()},
-		    {"us", makeConverter<std::chrono::microseconds>()},
-		    {"ms", makeConverter<std::chrono::milliseconds>()},
-		    {"s", makeConverter<std::chrono::seconds>()},
-		    {"m", makeConverter<std::chrono::minutes>()},
-		    {"h", makeConverter<std::chrono::hours>()},
-		    {"d", makeConverter<std::chrono::days>()},
-		    {"w", makeConverter<std::chrono::weeks>()},
-		    {"M", makeConverter<std::chrono::months>()},
-		    {"mo", makeConverter<std::chrono::months>()},
-		    {"y", makeConverter<std::chrono::years>()}};
-
-		std::regex  regex("(-?[0-9]+)([a-zA-Z])+");
-		std::smatch match;
-		Duration    duration{Duration::zero()};
-
-		while (std::regex_search(str, match, regex)) {
-			if (!converters.contains(match[2].str())) {
-				throw std::runtime_error("Unknown duration unit: " + match[2].str());
-			}
-			duration += converters[match[2].str()](std::stoll(match[1].str()));
-			str = match.suffix().str();
+	static Duration parse(std::string_view str) {
+		Rep              total;
+		std::string_view unit;
+		switch (scan(str, total, unit)) {
+			case Status::Ok:
+				return Duration{total};
+			case Status::Overflow:
+				throw std::overflow_error("Duration out of range: " + std::string{str});
+			case Status::UnknownUnit:
+				throw std::runtime_error("Unknown duration unit: " + std::string{unit});
+			default:
+				throw std::runtime_error("Invalid duration: " + std::string{str});
 		}
+	}
 
-		return duration;
+	// Like parse, without exceptions
+	static detail::Conversion tryParse(std::string_view str, Duration& result) {
+		Rep              total;
+		std::string_view unit;
+		switch (scan(str, total, unit)) {
+			case Status::Ok:
+				result = Duration{total};
+				return detail::Conversion::Ok;
+			case Status::Overflow:
+				return detail::Conversion::OutOfRange;
+			default:
+				return detail::Conversion::Invalid;
+		}
 	}
 };
 
 } // namespace simple_yaml
 
-#endif // __SIMPLE_YAML_PARSER_HPP__
\ No newline at end of file
+#endif // __SIMPLE_YAML_PARSER_HPP__
@@ -0,0 +1,108 @@
+#ifndef __SIMPLE_YAML_PATH_HPP__
+#define __SIMPLE_YAML_PATH_HPP__
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "Hash.hpp"
+
+namespace simple_yaml {
+
+// Location of a node inside the document, e.g. `/servers[1]/port`.
+//
+// Every segment only references its parent and its key, so building a path is free. Segments are meant to live on the stack
+// while the node is being deserialized, the string is assembled only when it is needed (usually an error message).
+class Path {
+public:
+	Path() = default;
+
+	Path(const char* root) : _key(root) {
+	}
+
+	Path(const std::string& root) : _key(root) {
+	}
+
+	Path(std::string_view root) : _key(root) {
+	}
+
+	// Mapping entry `parent/key`
+	Path(const Path& parent, std::string_view key) : _parent(&parent), _key(key), _kind(Kind::Key) {
+	}
+
+	// Sequence element `parent[index]`
+	Path(const Path& parent, std::size_t index) : _parent(&parent), _index(index), _kind(Kind::Index) {
+	}
+
+	std::string str() const {
+		std::string result;
+		append(result);
+		return result;
+	}
+
+	// Hash of the segments, without assembling the string
+	std::uint64_t hash() const {
+		std::uint64_t result = _parent != nullptr ? _parent->hash() : fnv1a({});
+		switch (_kind) {
+			case Kind::Root:
+				return fnv1a(_key, result);
+			case Kind::Key:
+				return fnv1a(_key, fnv1a("/", result));
+			case Kind::Index:
+				return fnv1a({reinterpret_cast<const char*>(&_index), sizeof(_index)}, fnv1a("[", result));
+		}
+		return result;
+	}
+
+	operator std::string() const {
+		return str();
+	}
+
+	friend std::string operator+(std::string lhs, const Path& rhs) {
+		rhs.append(lhs);
+		return lhs;
+	}
+
+	friend std::string operator+(const char* lhs, const Path& rhs) {
+		return std::string{lhs} + rhs;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const Path& path) {
+		return os << path.str();
+	}
+
+private:
+	enum class Kind { Root, Key, Index };
+
+	void append(std::string& out) const {
+		if (_parent != nullptr) {
+			_parent->append(out);
+		}
+		switch (_kind) {
+			case Kind::Root:
+				out += _key;
+				break;
+			case Kind::Key:
+				out += '/';
+				out += _key;
+				break;
+			case Kind::Index:
+				out += '[';
+				out += std::to_string(_index);
+				out += ']';
+				break;
+		}
+	}
+
+	const Path*      _parent{nullptr};
+	std::string_view _key;
+	std::size_t      _index{0};
+	Kind             _kind{Kind::Root};
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_PATH_HPP__
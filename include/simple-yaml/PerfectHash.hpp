@@ -0,0 +1,124 @@
+#ifndef __SIMPLE_YAML_PERFECT_HASH_HPP__
+#define __SIMPLE_YAML_PERFECT_HASH_HPP__
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include "Hash.hpp"
+
+namespace simple_yaml {
+
+namespace detail {
+
+// Perfect hash over a set of distinct names, built at compile time (hash and displace).
+//
+// Names are spread over buckets by their hash. Every bucket then gets the first seed which puts all of its names in free slots
+// of the table, largest buckets first. A lookup hashes the text twice and compares it with the one name in its slot.
+template<std::size_t N>
+class PerfectHash {
+public:
+	static constexpr std::size_t npos = N;
+
+	constexpr explicit PerfectHash(const std::array<std::string_view, N>& names) : _names(names) {
+		_entries.fill(npos);
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = i + 1; j < N; ++j) {
+				if (_names[i] == _names[j]) {
+					throw std::logic_error("Names of a perfect hash must be distinct");
+				}
+			}
+		}
+
+		std::array<std::size_t, buckets> sizes{};
+		for (const auto name : _names) {
+			++sizes[bucketOf(name)];
+		}
+
+		std::array<bool, buckets> placed{};
+		for (std::size_t round = 0; round < buckets; ++round) {
+			std::size_t bucket = 0;
+			for (std::size_t b = 0; b < buckets; ++b) {
+				if (!placed[b] && (placed[bucket] || sizes[b] > sizes[bucket])) {
+					bucket = b;
+				}
+			}
+			placed[bucket] = true;
+			if (sizes[bucket] == 0) {
+				break;
+			}
+
+			for (std::uint32_t seed = 1;; ++seed) {
+				std::array<std::size_t, slots> taken = _entries;
+				bool                           fits  = true;
+				for (std::size_t i = 0; i < N && fits; ++i) {
+					if (bucketOf(_names[i]) != bucket) {
+						continue;
+					}
+					auto& entry = taken[slotOf(_names[i], seed)];
+					fits        = entry == npos;
+					entry       = i;
+				}
+				if (fits) {
+					_seeds[bucket] = seed;
+					_entries       = taken;
+					break;
+				}
+			}
+		}
+	}
+
+	// Index of the name, npos when it is not in the set
+	constexpr std::size_t find(std::string_view name) const {
+		if constexpr (N == 0) {
+			return npos;
+		} else {
+			const auto entry = _entries[slotOf(name, _seeds[bucketOf(name)])];
+			return entry != npos && _names[entry] == name ? entry : npos;
+		}
+	}
+
+	constexpr const std::array<std::string_view, N>& names() const {
+		return _names;
+	}
+
+private:
+	static constexpr std::size_t buckets = N / 2 + 1;
+	static constexpr std::size_t slots   = [] {
+		std::size_t size = 1;
+		while (size < N + N / 4 + 1) {
+			size *= 2;
+		}
+		return size;
+	}();
+
+	static constexpr std::uint32_t maxSeed = 1u << 20;
+
+	// The low bits of FNV-1a depend only on the low bits of the characters, they are mixed with the high ones
+	static constexpr std::uint64_t mix(std::uint64_t hash) {
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdull;
+		return hash ^ (hash >> 33);
+	}
+
+	static constexpr std::size_t bucketOf(std::string_view name) {
+		return mix(fnv1a(name)) % buckets;
+	}
+
+	static constexpr std::size_t slotOf(std::string_view name, std::uint32_t seed) {
+		return mix(fnv1a(name, fnv1a({}) ^ (seed * 0x9e3779b97f4a7c15ull))) & (slots - 1);
+	}
+
+	std::array<std::string_view, N>    _names;
+	std::array<std::uint32_t, buckets> _seeds{};
+	std::array<std::size_t, slots>     _entries{};
+};
+
+} // namespace detail
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_PERFECT_HASH_HPP__
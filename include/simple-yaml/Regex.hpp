@@ -0,0 +1,657 @@
+#ifndef __SIMPLE_YAML_REGEX_HPP__
+#define __SIMPLE_YAML_REGEX_HPP__
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace simple_yaml {
+
+// Process-wide cache of compiled regular expressions.
+//
+// Compiling a std::regex is expensive, the cache makes sure every pattern is compiled only once no matter how many fields (or
+// elements of a sequence) use it. Compiled expressions are shared and immutable, so they can be used from any thread.
+class RegexCache {
+public:
+	using flag_type = std::regex::flag_type;
+
+	static std::shared_ptr<const std::regex> get(const std::string& pattern, flag_type flags = std::regex::ECMAScript) {
+		auto& cache = instance();
+		Key   key{pattern, flags};
+		{
+			std::lock_guard lock{cache._mutex};
+			if (auto it = cache._regexes.find(key); it != cache._regexes.end()) {
+				return it->second;
+			}
+		}
+
+		auto regex = std::make_shared<const std::regex>(pattern, flags);
+
+		std::lock_guard lock{cache._mutex};
+		return cache._regexes.try_emplace(std::move(key), std::move(regex)).first->second;
+	}
+
+	static std::size_t size() {
+		auto&           cache = instance();
+		std::lock_guard lock{cache._mutex};
+		return cache._regexes.size();
+	}
+
+	static void clear() {
+		auto&           cache = instance();
+		std::lock_guard lock{cache._mutex};
+		cache._regexes.clear();
+	}
+
+private:
+	using Key = std::pair<std::string, flag_type>;
+
+	struct KeyHash {
+		std::size_t operator()(const Key& key) const noexcept {
+			return std::hash<std::string>{}(key.first) ^ (static_cast<std::size_t>(key.second) * 0x9e3779b97f4a7c15ull);
+		}
+	};
+
+	static RegexCache& instance() {
+		static RegexCache cache;
+		return cache;
+	}
+
+	std::mutex                                                          _mutex;
+	std::unordered_map<Key, std::shared_ptr<const std::regex>, KeyHash> _regexes;
+};
+
+// String literal usable as a template argument, e.g. `StaticRegex<"^[a-z]+$">`
+template<std::size_t N>
+struct FixedString {
+	constexpr FixedString(const char (&str)[N]) {
+		std::copy_n(str, N, data);
+	}
+
+	constexpr std::string_view view() const {
+		return {data, N - 1};
+	}
+
+	char data[N]{};
+};
+
+namespace detail::regex {
+
+// Set of bytes matched by a single position of the pattern
+struct CharSet {
+	constexpr void add(unsigned char c) {
+		bits[c >> 6] |= std::uint64_t{1} << (c & 63);
+	}
+
+	constexpr void add(unsigned char lo, unsigned char hi) {
+		for (unsigned c = lo; c <= hi; ++c) {
+			add(static_cast<unsigned char>(c));
+		}
+	}
+
+	constexpr void add(const CharSet& other) {
+		for (std::size_t i{0}; i < 4; ++i) {
+			bits[i] |= other.bits[i];
+		}
+	}
+
+	constexpr void invert() {
+		for (auto& b : bits) {
+			b = ~b;
+		}
+	}
+
+	constexpr bool test(unsigned char c) const {
+		return (bits[c >> 6] >> (c & 63)) & 1;
+	}
+
+	std::uint64_t bits[4]{};
+};
+
+inline constexpr std::uint32_t unbounded = std::numeric_limits<std::uint32_t>::max();
+
+enum class Op : std::uint8_t {
+	Set,    // consume one byte from `set`
+	Repeat, // consume `x` to `y` bytes from `set`, greedy with backtracking
+	Split,  // try `x`, then `y`
+	Jmp,    // continue at `x`
+	Bol,    // beginning of input
+	Eol,    // end of input
+	Match,
+};
+
+struct Instr {
+	Op            op{Op::Match};
+	CharSet       set{};
+	std::uint32_t x{0};
+	std::uint32_t y{0};
+};
+
+// Parses an ECMAScript subset (literals, escapes, `.`, classes, groups, alternation, greedy and lazy quantifiers, anchors) and
+// compiles it into a backtracking program. Anything outside of the subset is a compile-time error.
+template<std::size_t NodeCapacity, std::size_t Capacity>
+class Compiler {
+	enum class Kind : std::uint8_t { Empty, Set, Bol, Eol, Concat, Alt, Repeat };
+
+	struct Node {
+		Kind          kind{Kind::Empty};
+		CharSet       set{};
+		int           child{-1};
+		int           sibling{-1};
+		std::uint32_t min{0};
+		std::uint32_t max{0};
+		bool          nullable{true};
+	};
+
+public:
+	constexpr explicit Compiler(std::string_view pattern) : _pattern(pattern) {
+		const int root = parseAlt();
+		if (_pos != _pattern.size()) {
+			error("unmatched ')'");
+		}
+		generate(root);
+		emit({Op::Match});
+	}
+
+	constexpr std::size_t size() const {
+		return _size;
+	}
+
+	constexpr const Instr& operator[](std::size_t i) const {
+		return _program[i];
+	}
+
+private:
+	[[noreturn]] static void error(const char* what) {
+		throw std::invalid_argument(what);
+	}
+
+	constexpr bool atEnd() const {
+		return _pos == _pattern.size();
+	}
+
+	constexpr char peek() const {
+		return _pattern[_pos];
+	}
+
+	constexpr int node(Node n) {
+		if (_nodeCount == NodeCapacity) {
+			error("regular expression is too complex");
+		}
+		_nodes[_nodeCount] = n;
+		return static_cast<int>(_nodeCount++);
+	}
+
+	constexpr int setNode(const CharSet& set) {
+		return node({.kind = Kind::Set, .set = set, .nullable = false});
+	}
+
+	// Appends `child` to the list of children of `parent`
+	constexpr void append(int parent, int& last, int child) {
+		if (last < 0) {
+			_nodes[parent].child = child;
+		} else {
+			_nodes[last].sibling = child;
+		}
+		last = child;
+	}
+
+	constexpr int parseAlt() {
+		int first = parseConcat();
+		if (atEnd() || peek() != '|') {
+			return first;
+		}
+
+		const int alt  = node({.kind = Kind::Alt, .nullable = false});
+		int       last = -1;
+		append(alt, last, first);
+		_nodes[alt].nullable = _nodes[first].nullable;
+		while (!atEnd() && peek() == '|') {
+			++_pos;
+			const int next = parseConcat();
+			append(alt, last, next);
+			_nodes[alt].nullable = _nodes[alt].nullable || _nodes[next].nullable;
+		}
+		return alt;
+	}
+
+	constexpr int parseConcat() {
+		const int concat = node({.kind = Kind::Concat});
+		int       last   = -1;
+		int       count  = 0;
+		while (!atEnd() && peek() != '|' && peek() != ')') {
+			const int item = parseQuantifier(parseAtom());
+			append(concat, last, item);
+			_nodes[concat].nullable = _nodes[concat].nullable && _nodes[item].nullable;
+			++count;
+		}
+		if (count == 1) {
+			return _nodes[concat].child;
+		}
+		return concat;
+	}
+
+	constexpr int parseAtom() {
+		const char c = peek();
+		++_pos;
+		switch (c) {
+			case '(': {
+				if (!atEnd() && peek() == '?') {
+					if (_pos + 1 >= _pattern.size() || _pattern[_pos + 1] != ':') {
+						error("only non-capturing groups '(?:' are supported");
+					}
+					_pos += 2;
+				}
+				const int inner = parseAlt();
+				if (atEnd() || peek() != ')') {
+					error("missing ')'");
+				}
+				++_pos;
+				return inner;
+			}
+			case '[':
+				return setNode(parseClass());
+			case '.': {
+				CharSet set;
+				set.add('\n');
+				set.add('\r');
+				set.invert();
+				return setNode(set);
+			}
+			case '^':
+				return node({.kind = Kind::Bol});
+			case '$':
+				return node({.kind = Kind::Eol});
+			case '\\':
+				return setNode(parseEscape(false));
+			case '*':
+			case '+':
+			case '?':
+			case '{':
+				error("nothing to repeat");
+			default: {
+				CharSet set;
+				set.add(static_cast<unsigned char>(c));
+				return setNode(set);
+			}
+		}
+	}
+
+	constexpr std::uint32_t parseNumber() {
+		if (atEnd() || peek() < '0' || peek() > '9') {
+			error("expected a number in '{}'");
+		}
+		std::uint32_t value{0};
+		while (!atEnd() && peek() >= '0' && peek() <= '9') {
+			value = value * 10 + static_cast<std::uint32_t>(peek() - '0');
+			++_pos;
+		}
+		return value;
+	}
+
+	constexpr int parseQuantifier(int atom) {
+		if (atEnd()) {
+			return atom;
+		}
+
+		std::uint32_t min{0};
+		std::uint32_t max{0};
+		switch (peek()) {
+			case '*':
+				min = 0;
+				max = unbounded;
+				break;
+			case '+':
+				min = 1;
+				max = unbounded;
+				break;
+			case '?':
+				min = 0;
+				max = 1;
+				break;
+			case '{':
+				++_pos;
+				min = max = parseNumber();
+				if (!atEnd() && peek() == ',') {
+					++_pos;
+					max = !atEnd() && peek() == '}' ? unbounded : parseNumber();
+				}
+				if (atEnd() || peek() != '}' || max < min) {
+					error("invalid '{}' quantifier");
+				}
+				break;
+			default:
+				return atom;
+		}
+		++_pos;
+		// Lazy quantifiers can only change which match is found, not whether the whole input matches
+		if (!atEnd() && peek() == '?') {
+			++_pos;
+		}
+		if (!atEnd() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{')) {
+			error("nothing to repeat");
+		}
+		if (max == unbounded && _nodes[atom].nullable) {
+			error("unbounded repetition of an expression matching the empty string is not supported");
+		}
+
+		return node({.kind = Kind::Repeat, .child = atom, .min = min, .max = max, .nullable = min == 0 || _nodes[atom].nullable});
+	}
+
+	constexpr CharSet parseEscape(bool inClass) {
+		if (atEnd()) {
+			error("trailing '\\'");
+		}
+		const char c = peek();
+		++_pos;
+
+		CharSet set;
+		switch (c) {
+			case 'd':
+			case 'D':
+				set.add('0', '9');
+				break;
+			case 'w':
+			case 'W':
+				set.add('a', 'z');
+				set.add('A', 'Z');
+				set.add('0', '9');
+				set.add('_');
+				break;
+			case 's':
+			case 'S':
+				for (char ws : {' ', '\t', '\n', '\r', '\f', '\v'}) {
+					set.add(static_cast<unsigned char>(ws));
+				}
+				break;
+			case 'n':
+				set.add('\n');
+				return set;
+			case 't':
+				set.add('\t');
+				return set;
+			case 'r':
+				set.add('\r');
+				return set;
+			case 'f':
+				set.add('\f');
+				return set;
+			case 'v':
+				set.add('\v');
+				return set;
+			case '0':
+				set.add('\0');
+				return set;
+			case 'b':
+				if (!inClass) {
+					error("word boundaries are not supported");
+				}
+				set.add('\b');
+				return set;
+			default:
+				if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+					error("unsupported escape sequence");
+				}
+				set.add(static_cast<unsigned char>(c));
+				return set;
+		}
+		if (c == 'D' || c == 'W' || c == 'S') {
+			set.invert();
+		}
+		return set;
+	}
+
+	// Parses the class after the opening '['
+	constexpr CharSet parseClass() {
+		CharSet set;
+		bool    negate = !atEnd() && peek() == '^';
+		if (negate) {
+			++_pos;
+		}
+
+		while (!atEnd() && peek() != ']') {
+			const bool escaped = peek() == '\\';
+			++_pos;
+			CharSet lo = escaped ? parseEscape(true) : CharSet{};
+			char    loChar{_pattern[_pos - 1]};
+			// Only single characters (not \d, \w, ...) can start a range
+			const bool single = !escaped || !(loChar == 'd' || loChar == 'D' || loChar == 'w' || loChar == 'W' || loChar == 's' || loChar == 'S');
+			if (escaped && single) {
+				for (unsigned i{0}; i < 256; ++i) {
+					if (lo.test(static_cast<unsigned char>(i))) {
+						loChar = static_cast<char>(i);
+					}
+				}
+			}
+
+			if (single && _pos + 1 < _pattern.size() && peek() == '-' && _pattern[_pos + 1] != ']') {
+				++_pos;
+				char hiChar = peek();
+				++_pos;
+				if (hiChar == '\\') {
+					const CharSet hi = parseEscape(true);
+					for (unsigned i{0}; i < 256; ++i) {
+						if (hi.test(static_cast<unsigned char>(i))) {
+							hiChar = static_cast<char>(i);
+						}
+					}
+				}
+				if (static_cast<unsigned char>(hiChar) < static_cast<unsigned char>(loChar)) {
+					error("invalid range in character class");
+				}
+				set.add(static_cast<unsigned char>(loChar), static_cast<unsigned char>(hiChar));
+			} else if (escaped) {
+				set.add(lo);
+			} else {
+				set.add(static_cast<unsigned char>(loChar));
+			}
+		}
+		if (atEnd()) {
+			error("missing ']'");
+		}
+		++_pos;
+
+		if (negate) {
+			set.invert();
+		}
+		return set;
+	}
+
+	constexpr std::size_t emit(Instr instr) {
+		if (_size == Capacity) {
+			error("regular expression is too complex");
+		}
+		_program[_size] = instr;
+		return _size++;
+	}
+
+	constexpr std::uint32_t here() const {
+		return static_cast<std::uint32_t>(_size);
+	}
+
+	constexpr void generate(int index) {
+		const Node& n = _nodes[index];
+		switch (n.kind) {
+			case Kind::Empty:
+				break;
+			case Kind::Set:
+				emit({Op::Set, n.set});
+				break;
+			case Kind::Bol:
+				emit({Op::Bol});
+				break;
+			case Kind::Eol:
+				emit({Op::Eol});
+				break;
+			case Kind::Concat:
+				for (int child = n.child; child >= 0; child = _nodes[child].sibling) {
+					generate(child);
+				}
+				break;
+			case Kind::Alt: {
+				std::array<std::size_t, Capacity> jumps{};
+				std::size_t                       jumpCount{0};
+				for (int child = n.child; child >= 0; child = _nodes[child].sibling) {
+					if (_nodes[child].sibling < 0) {
+						generate(child);
+						break;
+					}
+					const auto split = emit({Op::Split});
+					_program[split].x = here();
+					generate(child);
+					jumps[jumpCount++] = emit({Op::Jmp});
+					_program[split].y  = here();
+				}
+				for (std::size_t i{0}; i < jumpCount; ++i) {
+					_program[jumps[i]].x = here();
+				}
+				break;
+			}
+			case Kind::Repeat:
+				generateRepeat(n);
+				break;
+		}
+	}
+
+	constexpr void generateRepeat(const Node& n) {
+		const Node& child = _nodes[n.child];
+		if (child.kind == Kind::Set) {
+			emit({Op::Repeat, child.set, n.min, n.max});
+			return;
+		}
+
+		for (std::uint32_t i{0}; i < n.min; ++i) {
+			generate(n.child);
+		}
+		if (n.max == unbounded) {
+			const auto split  = emit({Op::Split});
+			_program[split].x = here();
+			generate(n.child);
+			emit({Op::Jmp, {}, static_cast<std::uint32_t>(split)});
+			_program[split].y = here();
+			return;
+		}
+
+		std::array<std::size_t, Capacity> splits{};
+		std::size_t                       splitCount{0};
+		for (std::uint32_t i{n.min}; i < n.max; ++i) {
+			const auto split  = emit({Op::Split});
+			_program[split].x = here();
+			splits[splitCount++] = split;
+			generate(n.child);
+		}
+		for (std::size_t i{0}; i < splitCount; ++i) {
+			_program[splits[i]].y = here();
+		}
+	}
+
+	std::string_view               _pattern;
+	std::size_t                    _pos{0};
+	std::array<Node, NodeCapacity> _nodes{};
+	std::size_t                    _nodeCount{0};
+	std::array<Instr, Capacity>    _program{};
+	std::size_t                    _size{0};
+};
+
+inline bool run(const Instr* program, std::size_t pc, const char* sp, const char* begin, const char* end) {
+	while (true) {
+		const Instr& in = program[pc];
+		switch (in.op) {
+			case Op::Set:
+				if (sp == end || !in.set.test(static_cast<unsigned char>(*sp))) {
+					return false;
+				}
+				++sp;
+				++pc;
+				break;
+			case Op::Repeat: {
+				std::size_t count{0};
+				while (count < in.y && sp + count != end && in.set.test(static_cast<unsigned char>(sp[count]))) {
+					++count;
+				}
+				if (count < in.x) {
+					return false;
+				}
+				if (program[pc + 1].op == Op::Match) {
+					return sp + count == end;
+				}
+				for (;; --count) {
+					if (run(program, pc + 1, sp + count, begin, end)) {
+						return true;
+					}
+					if (count == in.x) {
+						return false;
+					}
+				}
+			}
+			case Op::Split:
+				if (run(program, in.x, sp, begin, end)) {
+					return true;
+				}
+				pc = in.y;
+				break;
+			case Op::Jmp:
+				pc = in.x;
+				break;
+			case Op::Bol:
+				if (sp != begin) {
+					return false;
+				}
+				++pc;
+				break;
+			case Op::Eol:
+				if (sp != end) {
+					return false;
+				}
+				++pc;
+				break;
+			case Op::Match:
+				return sp == end;
+		}
+	}
+}
+
+} // namespace detail::regex
+
+// Regular expression compiled at compile time, `match` has the semantics of std::regex_match with ECMAScript grammar.
+//
+// Supported are literals, escapes (\d \w \s and their negations, \n, \t, ...), `.`, character classes, groups `(...)` and
+// `(?:...)`, alternation, quantifiers `* + ? {n} {n,} {n,m}` (lazy versions as well) and anchors `^ $`. Back-references,
+// look-arounds and word boundaries are rejected at compile time.
+template<FixedString Pattern>
+class StaticRegex {
+	static constexpr auto compile() {
+		// Counted repetitions of groups are expanded, hence the headroom of the program
+		constexpr auto size = Pattern.view().size();
+		constexpr detail::regex::Compiler<size * 2 + 8, size * 4 + 1024> compiler{Pattern.view()};
+
+		std::array<detail::regex::Instr, compiler.size()> program{};
+		for (std::size_t i{0}; i < program.size(); ++i) {
+			program[i] = compiler[i];
+		}
+		return program;
+	}
+
+	static constexpr auto program = compile();
+
+public:
+	static bool match(std::string_view str) {
+		return detail::regex::run(program.data(), 0, str.data(), str.data(), str.data() + str.size());
+	}
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_REGEX_HPP__
@@ -0,0 +1,215 @@
+#ifndef __SIMPLE_YAML_RELOAD_HPP__
+#define __SIMPLE_YAML_RELOAD_HPP__
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <yaml-cpp/yaml.h>
+
+#include "Deserializer.hpp"
+#include "Hash.hpp"
+#include "Include.hpp"
+#include "Path.hpp"
+
+namespace simple_yaml {
+
+// Hash of the content of a subtree: node types, tags, scalars and the order of entries
+inline std::uint64_t fingerprint(const YAML::Node& n, std::uint64_t hash = fnv1a({})) {
+	const auto text = [&hash](std::string_view value) {
+		const auto size = static_cast<std::uint64_t>(value.size());
+		hash            = fnv1a(value, fnv1a({reinterpret_cast<const char*>(&size), sizeof(size)}, hash));
+	};
+
+	const char type = static_cast<char>('0' + n.Type());
+	hash            = fnv1a({&type, 1}, hash);
+	text(n.Tag());
+	switch (n.Type()) {
+		case YAML::NodeType::Scalar:
+			text(n.Scalar());
+			break;
+		case YAML::NodeType::Sequence:
+			for (const auto& element : n) {
+				hash = fingerprint(element, hash);
+			}
+			hash = fnv1a("]", hash);
+			break;
+		case YAML::NodeType::Map:
+			for (auto it = n.begin(); it != n.end(); ++it) {
+				hash = fingerprint(it->first, hash);
+				hash = fingerprint(it->second, hash);
+			}
+			hash = fnv1a("}", hash);
+			break;
+		default:
+			break;
+	}
+	return hash;
+}
+
+// Values of bound fields from the previous load, keyed by path and type and checked by the fingerprint of their subtree.
+//
+// While a Reload::Scope is alive on the binding thread, every field of a Simple-derived structure with an unchanged subtree gets
+// a copy of its previous value, its deserializer and rules do not run again. Changed subtrees are deserialized as usual, their
+// fields are looked up in turn. It pays off for fields with rules or expensive deserializers, plain scalars cost about the same
+// either way. Fields bound on other threads (Parallel) are not cached.
+class Reload {
+public:
+	class Scope {
+	public:
+		explicit Scope(Reload& reload) : _previous(std::exchange(_current, &reload)) {
+			++reload._generation;
+			reload._reused  = 0;
+			reload._rebuilt = 0;
+			reload._parent  = 0;
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_current = _previous;
+		}
+
+	private:
+		Reload* _previous;
+	};
+
+	// Marks the field whose value is being deserialized, fields stored meanwhile are nested in it
+	class Nested {
+	public:
+		Nested(Reload& reload, std::uint64_t key) : _reload(reload), _outer(std::exchange(reload._parent, key)) {
+		}
+
+		Nested(const Nested&)            = delete;
+		Nested& operator=(const Nested&) = delete;
+
+		~Nested() {
+			_reload._parent = _outer;
+		}
+
+		std::uint64_t outer() const {
+			return _outer;
+		}
+
+	private:
+		Reload&       _reload;
+		std::uint64_t _outer;
+	};
+
+	static Reload* current() {
+		return _current;
+	}
+
+	template<typename T>
+	static std::uint64_t keyOf(const Path& path) {
+		const auto type = static_cast<std::uint64_t>(std::type_index{typeid(T)}.hash_code());
+		return path.hash() ^ (type * 0x9e3779b97f4a7c15ull);
+	}
+
+	template<typename T>
+	std::optional<T> reuse(std::uint64_t key, std::uint64_t fingerprint) {
+		auto it = _entries.find(key);
+		if (it == _entries.end() || it->second.fingerprint != fingerprint) {
+			return std::nullopt;
+		}
+		it->second.generation = _generation;
+		it->second.reused     = _generation;
+		++_reused;
+		return *static_cast<const T*>(it->second.value.get());
+	}
+
+	template<typename T>
+	void store(std::uint64_t key, std::uint64_t parent, std::uint64_t fingerprint, const T& value) {
+		++_rebuilt;
+		_entries.insert_or_assign(key, Entry{fingerprint, parent, _generation, 0, std::make_shared<const T>(value)});
+	}
+
+	// Drops values of fields which were not bound by the last load, fields inside a reused value are kept for later loads
+	void sweep() {
+		std::erase_if(_entries, [this](const auto& entry) { return entry.second.generation != _generation && !insideReused(entry.second.parent); });
+	}
+
+	// Fields taken from the previous load and fields deserialized by the last load
+	std::size_t reused() const {
+		return _reused;
+	}
+
+	std::size_t rebuilt() const {
+		return _rebuilt;
+	}
+
+	std::size_t size() const {
+		return _entries.size();
+	}
+
+private:
+	struct Entry {
+		std::uint64_t               fingerprint;
+		std::uint64_t               parent;
+		std::size_t                 generation;
+		std::size_t                 reused;
+		std::shared_ptr<const void> value;
+	};
+
+	// Fields of a value that was reused were not visited, but they are still valid
+	bool insideReused(std::uint64_t parent) const {
+		while (parent != 0) {
+			auto it = _entries.find(parent);
+			if (it == _entries.end()) {
+				return false;
+			}
+			if (it->second.reused == _generation) {
+				return true;
+			}
+			if (it->second.generation == _generation) {
+				return false;
+			}
+			parent = it->second.parent;
+		}
+		return false;
+	}
+
+	std::unordered_map<std::uint64_t, Entry> _entries;
+	std::uint64_t                            _parent{0};
+	std::size_t                              _generation{0};
+	std::size_t                              _reused{0};
+	std::size_t                              _rebuilt{0};
+
+	static inline thread_local Reload* _current{nullptr};
+};
+
+// Binds `T` again whenever the document changed, fields of unchanged subtrees are reused from the previous load (see Reload)
+template<typename T>
+class Reloader {
+public:
+	T bind(const YAML::Node& root, const Path& path = {}) {
+		T value = [&] {
+			Reload::Scope scope{_reload};
+			return Deserializer<T>::deserialize(root, path);
+		}();
+		_reload.sweep();
+		return value;
+	}
+
+	T bindFile(const std::string& filename, const Path& path = {}) {
+		return bind(Includes::shared().fromFile(filename), path);
+	}
+
+	const Reload& stats() const {
+		return _reload;
+	}
+
+private:
+	Reload _reload;
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_RELOAD_HPP__
@@ -0,0 +1,234 @@
+#ifndef __SIMPLE_YAML_SERIALIZER_HPP__
+#define __SIMPLE_YAML_SERIALIZER_HPP__
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <ratio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#if defined(__has_include) && __has_include(<magic_enum.hpp>)
+#	include <magic_enum.hpp>
+#endif
+
+#include "Emitter.hpp"
+#include "Number.hpp"
+
+namespace simple_yaml {
+
+// Counterpart of Deserializer, writes the value into an Emitter
+template<typename T>
+struct Serializer {
+	//static_assert(false, "Unsopported type, you need to implement Serializer.");
+};
+
+// Floats are written in the shortest form which reads back as the same value
+template<typename T>
+requires std::is_integral_v<T> || std::is_floating_point_v<T>
+struct Serializer<T> {
+	static void serialize(Emitter& out, const T& value) {
+		if constexpr (std::is_same_v<T, bool>) {
+			out.scalar(value ? "true" : "false");
+		} else if constexpr (detail::isNumber<T>) {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (std::isnan(value)) {
+					out.scalar(".nan");
+					return;
+				}
+				if (std::isinf(value)) {
+					out.scalar(value < 0 ? "-.inf" : ".inf");
+					return;
+				}
+			}
+			char buffer[64];
+			const auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+			out.scalar({buffer, static_cast<std::size_t>(ptr - buffer)});
+		} else {
+			const char c = static_cast<char>(value);
+			out.string({&c, 1});
+		}
+	}
+};
+
+#if defined(__has_include) && __has_include(<magic_enum.hpp>)
+
+template<typename T>
+requires std::is_enum_v<T>
+struct Serializer<T> {
+	static void serialize(Emitter& out, const T& value) {
+		const auto name = magic_enum::enum_name(value);
+		if (name.empty()) {
+			throw std::invalid_argument("Enum value without a name cannot be serialized");
+		}
+		out.string(name);
+	}
+};
+
+#endif
+
+// Durations are written in units, e.g. `1d 2h 30m`, as DurationParser reads them
+template<typename Rep, typename Period>
+struct Serializer<std::chrono::duration<Rep, Period>> {
+	static void serialize(Emitter& out, const std::chrono::duration<Rep, Period>& value) {
+		char        buffer[capacity];
+		std::size_t size  = 0;
+		Rep         count = value.count();
+		if constexpr (std::is_integral_v<Rep>) {
+			if (count != 0) {
+				component<std::chrono::days::period>("d", count, buffer, size);
+				component<std::chrono::hours::period>("h", count, buffer, size);
+				component<std::chrono::minutes::period>("m", count, buffer, size);
+				component<std::chrono::seconds::period>("s", count, buffer, size);
+				component<std::milli>("ms", count, buffer, size);
+				component<std::micro>("us", count, buffer, size);
+				component<std::nano>("ns", count, buffer, size);
+			}
+		}
+		// zero, floating point counts and periods which are not whole units are written as a plain count
+		if (size == 0 || count != 0) {
+			size = static_cast<std::size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value.count()).ptr - buffer);
+		}
+		out.scalar({buffer, size});
+	}
+
+private:
+	// seven components of at most 20 digits, a sign, a unit and a separator
+	static constexpr std::size_t capacity = 7 * 24;
+
+	// Moves the whole units out of `count` (in Period), when a unit is a whole number of periods
+	template<typename Unit>
+	static void component(std::string_view name, Rep& count, char* buffer, std::size_t& size) {
+		using Factor = std::ratio_divide<Unit, Period>;
+		if constexpr (Factor::den == 1) {
+			const Rep units = count / static_cast<Rep>(Factor::num);
+			if (units != 0) {
+				if (size != 0) {
+					buffer[size++] = ' ';
+				}
+				size += static_cast<std::size_t>(std::to_chars(buffer + size, buffer + capacity, units).ptr - (buffer + size));
+				for (const char c : name) {
+					buffer[size++] = c;
+				}
+				count -= units * static_cast<Rep>(Factor::num);
+			}
+		}
+	}
+};
+
+template<typename T>
+requires std::is_same_v<T, std::string> || std::is_same_v<T, std::pmr::string> || std::is_same_v<T, std::string_view>
+struct Serializer<T> {
+	static void serialize(Emitter& out, const T& value) {
+		out.string(value);
+	}
+};
+
+template<>
+struct Serializer<std::filesystem::path> {
+	static void serialize(Emitter& out, const std::filesystem::path& value) {
+		out.string(value.string());
+	}
+};
+
+namespace detail {
+
+template<typename Range>
+void serializeSequence(Emitter& out, const Range& values) {
+	out.beginSequence();
+	for (const auto& value : values) {
+		out.element().value(value);
+	}
+	out.endSequence();
+}
+
+} // namespace detail
+
+template<typename T, size_t N>
+struct Serializer<std::array<T, N>> {
+	static void serialize(Emitter& out, const std::array<T, N>& values) {
+		detail::serializeSequence(out, values);
+	}
+};
+
+template<typename T, typename Allocator>
+struct Serializer<std::vector<T, Allocator>> {
+	static void serialize(Emitter& out, const std::vector<T, Allocator>& values) {
+		detail::serializeSequence(out, values);
+	}
+};
+
+template<typename T>
+struct Serializer<std::span<const T>> {
+	static void serialize(Emitter& out, const std::span<const T>& values) {
+		detail::serializeSequence(out, values);
+	}
+};
+
+// Associative containers, keys must serialize to scalars
+template<typename T>
+requires std::is_destructible_v<typename T::key_type> && std::is_destructible_v<typename T::mapped_type>
+struct Serializer<T> {
+	static void serialize(Emitter& out, const T& values) {
+		out.beginMap();
+		for (const auto& [key, value] : values) {
+			out.key().value(key).value(value);
+		}
+		out.endMap();
+	}
+};
+
+// Structures describe their fields in `void serialize(Emitter&) const`, e.g. `out.entry("host", host).entry("port", port);`
+template<typename T>
+requires requires(const T& value, Emitter& out) { value.serialize(out); }
+struct Serializer<T> {
+	static void serialize(Emitter& out, const T& value) {
+		out.beginMap();
+		value.serialize(out);
+		out.endMap();
+	}
+};
+
+template<typename T>
+concept serializable_v = requires(Emitter& out, const T& value) { Serializer<T>::serialize(out, value); };
+
+// Writes the value as a YAML document into `buffer`, which is cleared first, so its capacity is reused
+template<typename T>
+requires serializable_v<T>
+void toString(const T& value, std::string& buffer) {
+	buffer.clear();
+	Emitter out{buffer};
+	out.value(value);
+}
+
+template<typename T>
+requires serializable_v<T> std::string toString(const T& value) {
+	std::string buffer;
+	toString(value, buffer);
+	return buffer;
+}
+
+// Throws YAML::BadFile when the file cannot be written
+template<typename T>
+requires serializable_v<T>
+void toFile(const std::string& filename, const T& value) {
+	const auto    text = toString(value);
+	std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+	file.write(text.data(), static_cast<std::streamsize>(text.size()));
+	if (!file) {
+		throw YAML::BadFile(filename);
+	}
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_SERIALIZER_HPP__
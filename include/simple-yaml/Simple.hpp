@@ -4,24 +4,73 @@
 
 #	include <any>
 #	include <filesystem>
+#	include <memory_resource>
 #	include <optional>
 #	include <string>
+#	include <string_view>
 #	include <type_traits>
+#	include <utility>
+#	include <vector>
 #	include <yaml-cpp/yaml.h>
 #	include <pretty-name/pretty_name.hpp>
 
 #	include "Exception.hpp"
 #	include "Deserializer.hpp"
+#	include "Binding.hpp"
+#	include "Detach.hpp"
+#	include "Diagnostics.hpp"
 #	include "Field.hpp"
+#	include "Include.hpp"
+#	include "MappedFile.hpp"
+#	include "Memory.hpp"
+#	include "Path.hpp"
 
 namespace simple_yaml {
 
-constexpr auto fromFile   = YAML::LoadFile;
 constexpr auto fromString = static_cast<YAML::Node (*)(const std::string&)>(YAML::Load);
 constexpr auto fromStream = static_cast<YAML::Node (*)(std::istream&)>(YAML::Load);
 
+// Parses the file and replaces its `!include` scalars by the fragments they name, see Includes
+inline YAML::Node fromFile(const std::string& filename) {
+	return Includes::shared().fromFile(filename);
+}
+
+// Like fromFile, but the parser reads the file through a read-only memory mapping instead of an std::ifstream. yaml-cpp copies
+// scalars into the nodes, so the mapping is released as soon as the document is parsed.
+inline YAML::Node fromMappedFile(const std::string& filename) {
+	const MappedFile file{filename};
+	return Includes::shared().parse(file.view(), std::filesystem::path{filename}.parent_path());
+}
+
+// Like fromString, a parser error is returned. yaml-cpp reports it by throwing, it is caught only when exceptions are enabled.
+inline Expected<YAML::Node> tryFromString(const std::string& text) {
+#	if defined(__cpp_exceptions)
+	try {
+		return YAML::Load(text);
+	} catch (const YAML::ParserException& e) {
+		return Unexpected{Error{Error::Kind::Parse, {}, e.mark, e.msg}};
+	}
+#	else
+	return YAML::Load(text);
+#	endif
+}
+
+namespace detail {
+
+// Finds the node of a key the structure declared at compile time, null for other keys (see Keyed)
+struct KeyLookup {
+	const void* index{nullptr};
+	const YAML::Node* (*find)(const void* index, std::string_view key){nullptr};
+};
+
+} // namespace detail
+
 struct Simple {
-	Simple(const YAML::Node& n, const std::string& path = "") : _data(n), _path(path) {
+	Simple(const YAML::Node& n, const Path& path = {}) : _data(n), _path(path) {
+	}
+	Simple(const YAML::Node& n, const Path& path, detail::KeyLookup lookup) : _data(n), _path(path), _lookup(lookup) {
+	}
+	Simple(stream::Binding& binding) : _path(binding.path()), _binding(&binding) {
 	}
 	Simple(const Simple& other) = default;
 	Simple(Simple&& other)      = default;
@@ -29,37 +78,148 @@ struct Simple {
 	Simple& operator=(Simple&& other) = default;
 
 	inline Field<void*> bound(const std::string& key) {
-		return Field<void*>{_data[key], _path + "/" + key};
+		return field<void*>(key);
 	}
 
 	template<typename T>
 	inline Field<T> bound(const std::string& key, const T& defVal) {
-		return Field<T>{_data[key], _path + "/" + key}.init(defVal);
+		return field<T>(key).init(defVal);
 	}
 
 	inline Field<std::string> bound(const std::string& key, const char* defVal) {
-		return Field<std::string>{_data[key], _path + "/" + key}.init(std::string{defVal});
+		return field<std::string>(key).init(std::string{defVal});
+	}
+
+	// Drops the node handle once the fields are bound, so the structure no longer keeps the parsed document alive. Fields bound
+	// afterwards find no node. See Detach for detaching whole configurations.
+	void detach() {
+		// one undefined node shared by all detached structures, lookups in it do not modify it
+		static const YAML::Node released{YAML::NodeType::Undefined};
+		_data.reset(released);
+		_path    = Path{};
+		_binding = nullptr;
+		_lookup  = {};
+	}
+
+	// Binds the structure without exceptions, the first failure is returned. Fields of types without a TryDeserializer are
+	// converted the regular way.
+	template<typename T>
+	requires std::is_base_of_v<Simple, T> && std::is_move_constructible_v<T>
+	static Expected<T> tryBind(const YAML::Node& n, const Path& path = {}) {
+		if (!n.IsDefined()) {
+			return Unexpected{Error{Error::Kind::MissingNode, path, n.Mark(), {}}};
+		}
+		if (!n.IsMap()) {
+			return Unexpected{Error{Error::Kind::InvalidNodeType, path, n.Mark(), {}}};
+		}
+		std::optional<Error> failure;
+		std::optional<T>     value;
+		{
+			const detail::TryBind::Scope scope{failure};
+			value.emplace(n, path);
+		}
+		if (failure.has_value()) {
+			return Unexpected{std::move(*failure)};
+		}
+		if (Detach::active()) {
+			value->detach();
+		}
+		return std::move(*value);
+	}
+
+	// Node graph kept alive through this structure's own handle, at least its subtree (the whole document when it is the root)
+	Footprint retained() const {
+		return footprint(_data);
 	}
 
 private:
-	YAML::Node  _data;
-	std::string _path;
+	template<typename Default>
+	Field<Default> field(const std::string& key) {
+		if (_binding != nullptr) {
+			return Field<Default>{*_binding, key, Path{_path, key}};
+		}
+		if (_lookup.find != nullptr) {
+			if (const auto* node = _lookup.find(_lookup.index, key)) {
+				return Field<Default>{*node, Path{_path, key}};
+			}
+		}
+		// const lookup, a missing key must not insert into the document, which other threads may be reading
+		return Field<Default>{std::as_const(_data)[key], Path{_path, key}};
+	}
+
+	// `_path`, `_binding` and `_lookup` are valid only while the derived structure is being constructed
+	YAML::Node        _data;
+	Path              _path;
+	stream::Binding*  _binding{nullptr};
+	detail::KeyLookup _lookup;
 };
 
 template<typename T>
 requires std::is_base_of_v<Simple, T>
 struct Deserializer<T> {
-	static T deserialize(const YAML::Node& n, const std::string& path) {
+	static T deserialize(const YAML::Node& n, const Path& path) {
 		if (!n.IsDefined()) {
 			throw MissingNode("Missing structured type node " + path, n.Mark());
 		}
 		if (!n.IsMap()) {
 			throw InvalidNodeType("Invalid node type " + path, n.Mark());
 		}
+		if constexpr (std::is_move_constructible_v<T>) {
+			if (Detach::active()) {
+				T value{n, path};
+				value.detach();
+				return value;
+			}
+		}
 		return T{n, path};
 	}
 };
 
+template<typename T>
+requires std::is_base_of_v<Simple, T> && std::is_move_constructible_v<T>
+struct TryDeserializer<T> {
+	static Expected<T> deserialize(const YAML::Node& n, const Path& path) {
+		return Simple::tryBind<T>(n, path);
+	}
+};
+
+// Binds the structure with every Simple-derived structure in it detached from the document (see Detach)
+template<typename T>
+requires std::is_base_of_v<Simple, T> T bindDetached(const YAML::Node& root, const Path& path = {}) {
+	const Detach::Scope scope;
+	return Deserializer<T>::deserialize(root, path);
+}
+
+// Binds the value with every std::pmr string and container in it allocated from the resource (see Memory)
+template<typename T>
+requires deserializable_v<T> T bindAllocated(const YAML::Node& root, std::pmr::memory_resource& resource, const Path& path = {}) {
+	const Memory::Scope scope{resource};
+	return Deserializer<T>::deserialize(root, path);
+}
+
+// Value bound while collecting diagnostics, empty when the root node itself could not be bound
+template<typename T>
+struct Collected {
+	std::optional<T>        value;
+	std::vector<Diagnostic> errors;
+};
+
+// Binds the value and reports all failures at once instead of throwing the first one (see Diagnostics)
+template<typename T>
+requires deserializable_v<T> Collected<T> bindCollecting(const YAML::Node& root, const Path& path = {}) {
+	Diagnostics  diagnostics;
+	Collected<T> result;
+	{
+		const Diagnostics::Scope scope{&diagnostics};
+		Diagnostics::attempt(path, root.Mark(), [&] { result.value.emplace(Deserializer<T>::deserialize(root, path)); });
+	}
+	result.errors = diagnostics.errors();
+	return result;
+}
+
 } // namespace simple_yaml
 
+#	include "Keyed.hpp"
+#	include "Stream.hpp"
+
 #endif // __SIMPLE_YAML_SIMPLE_HPP__
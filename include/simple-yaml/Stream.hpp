@@ -0,0 +1,878 @@
+#ifndef __SIMPLE_YAML_STREAM_HPP__
+#define __SIMPLE_YAML_STREAM_HPP__
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+#include <yaml-cpp/yaml.h>
+
+#include "Binding.hpp"
+#include "Deserializer.hpp"
+#include "Exception.hpp"
+#include "MappedFile.hpp"
+#include "Memory.hpp"
+#include "Path.hpp"
+#include "Simple.hpp"
+
+namespace simple_yaml {
+
+namespace stream {
+
+template<typename T>
+class TypedSink : public Sink {
+public:
+	virtual T take() = 0;
+
+	std::unique_ptr<Value> release() override {
+		return std::make_unique<TypedValue<T>>(take());
+	}
+};
+
+template<typename T>
+struct SinkFor;
+
+template<typename T>
+std::unique_ptr<TypedSink<T>> makeTypedSink() {
+	return std::make_unique<typename SinkFor<T>::type>();
+}
+
+template<typename T>
+std::unique_ptr<Sink> makeSink() {
+	return makeTypedSink<T>();
+}
+
+// Builds a YAML::Node out of the events, used for types without a streaming sink and for fields bound several times
+class NodeSink : public Sink {
+public:
+	void at(const Path&) override {
+	}
+
+	void scalar(const YAML::Mark&, const std::string& tag, const std::string& value) override {
+		YAML::Node node{value};
+		node.SetTag(tag);
+		attach(std::move(node));
+	}
+
+	void null(const YAML::Mark&) override {
+		attach(YAML::Node{YAML::NodeType::Null});
+	}
+
+	void beginSequence(const YAML::Mark&, const std::string& tag) override {
+		begin(YAML::NodeType::Sequence, tag);
+	}
+
+	void beginMap(const YAML::Mark&, const std::string& tag) override {
+		begin(YAML::NodeType::Map, tag);
+	}
+
+	Sink& element() override {
+		return *this;
+	}
+
+	void end() override {
+		auto node = std::move(_stack.back().node);
+		_stack.pop_back();
+		attach(std::move(node));
+	}
+
+	const YAML::Node& node() const {
+		return _node;
+	}
+
+	// YAML::Node assignment writes through to the referenced node, so nodes are rebound with `reset` instead
+	YAML::Node take() {
+		YAML::Node node = _node;
+		_node.reset();
+		return node;
+	}
+
+	std::unique_ptr<Value> release() override {
+		return std::make_unique<TypedValue<YAML::Node>>(take());
+	}
+
+private:
+	struct Collection {
+		YAML::Node                node;
+		std::optional<YAML::Node> key;
+	};
+
+	void begin(YAML::NodeType::value type, const std::string& tag) {
+		YAML::Node node{type};
+		node.SetTag(tag);
+		_stack.push_back({std::move(node), std::nullopt});
+	}
+
+	void attach(YAML::Node node) {
+		if (_stack.empty()) {
+			_node.reset(node);
+			return;
+		}
+		auto& top = _stack.back();
+		if (top.node.IsSequence()) {
+			top.node.push_back(node);
+		} else if (!top.key) {
+			top.key = std::move(node);
+		} else {
+			top.node.force_insert(*top.key, node);
+			top.key.reset();
+		}
+	}
+
+	YAML::Node              _node;
+	std::vector<Collection> _stack;
+};
+
+inline std::unique_ptr<Sink> makeNodeSink() {
+	return std::make_unique<NodeSink>();
+}
+
+// Ignores a value, e.g. of a key no field is bound to
+class SkipSink : public Sink {
+public:
+	void at(const Path&) override {
+	}
+	void scalar(const YAML::Mark&, const std::string&, const std::string&) override {
+	}
+	void null(const YAML::Mark&) override {
+	}
+	void beginSequence(const YAML::Mark&, const std::string&) override {
+	}
+	void beginMap(const YAML::Mark&, const std::string&) override {
+	}
+	Sink& element() override {
+		return *this;
+	}
+	void end() override {
+	}
+	std::unique_ptr<Value> release() override {
+		return nullptr;
+	}
+};
+
+// Captures a map key, the text of scalar keys is kept as is, complex keys are built into a node
+class KeySink : public Sink {
+public:
+	void at(const Path&) override {
+	}
+
+	void scalar(const YAML::Mark& mark, const std::string& tag, const std::string& value) override {
+		_kind = Kind::Scalar;
+		_mark = mark;
+		_tag  = tag;
+		_text = value;
+	}
+
+	void null(const YAML::Mark& mark) override {
+		_kind = Kind::Null;
+		_mark = mark;
+	}
+
+	void beginSequence(const YAML::Mark& mark, const std::string& tag) override {
+		_kind = Kind::Complex;
+		_node.beginSequence(mark, tag);
+	}
+
+	void beginMap(const YAML::Mark& mark, const std::string& tag) override {
+		_kind = Kind::Complex;
+		_node.beginMap(mark, tag);
+	}
+
+	Sink& element() override {
+		return _node.element();
+	}
+
+	void end() override {
+		_node.end();
+	}
+
+	std::unique_ptr<Value> release() override {
+		return nullptr;
+	}
+
+	bool isScalar() const {
+		return _kind == Kind::Scalar;
+	}
+
+	// Text of a scalar key, empty otherwise
+	std::string_view text() const {
+		return isScalar() ? std::string_view{_text} : std::string_view{};
+	}
+
+	template<typename T>
+	T into(TypedSink<T>& sink, const Path& path) {
+		sink.at(path);
+		switch (_kind) {
+			case Kind::Scalar:
+				sink.scalar(_mark, _tag, _text);
+				break;
+			case Kind::Null:
+				sink.null(_mark);
+				break;
+			case Kind::Complex:
+				return Deserializer<T>::deserialize(_node.take(), path);
+		}
+		return sink.take();
+	}
+
+private:
+	enum class Kind { Null, Scalar, Complex };
+
+	Kind        _kind{Kind::Null};
+	YAML::Mark  _mark{YAML::Mark::null_mark()};
+	std::string _tag;
+	std::string _text;
+	NodeSink    _node;
+};
+
+// Base of sinks deserializing natively, values of unexpected kinds are captured and given to Deserializer<T>, so both binding
+// modes behave the same.
+template<typename T>
+class NativeSink : public TypedSink<T> {
+public:
+	void at(const Path& path) override {
+		_path = path;
+	}
+
+	void scalar(const YAML::Mark& mark, const std::string& tag, const std::string& value) override {
+		fallback().scalar(mark, tag, value);
+	}
+
+	void null(const YAML::Mark& mark) override {
+		fallback().null(mark);
+	}
+
+	void beginSequence(const YAML::Mark& mark, const std::string& tag) override {
+		fallback().beginSequence(mark, tag);
+	}
+
+	void beginMap(const YAML::Mark& mark, const std::string& tag) override {
+		fallback().beginMap(mark, tag);
+	}
+
+	Sink& element() override {
+		return _fallback->element();
+	}
+
+	void end() override {
+		_fallback->end();
+	}
+
+	T take() override {
+		if (_fallback) {
+			return Deserializer<T>::deserialize(_fallback->take(), _path);
+		}
+		return takeNative();
+	}
+
+protected:
+	virtual T takeNative() = 0;
+
+	void native() {
+		_fallback.reset();
+	}
+
+	NodeSink& fallback() {
+		if (!_fallback) {
+			_fallback.emplace();
+		}
+		return *_fallback;
+	}
+
+	bool isFallback() const {
+		return _fallback.has_value();
+	}
+
+	Path _path;
+
+private:
+	std::optional<NodeSink> _fallback;
+};
+
+template<typename T>
+inline constexpr bool isDuration = false;
+
+template<typename Rep, typename Period>
+inline constexpr bool isDuration<std::chrono::duration<Rep, Period>> = true;
+
+// Scalars and every type without a dedicated sink
+template<typename T>
+class LeafSink : public NativeSink<T> {
+	// Deserializers of these types do not keep the node, so one node can be reused for all values
+	static constexpr bool reusesNode = std::is_arithmetic_v<T> || std::is_enum_v<T> || isDuration<T>;
+
+public:
+	void scalar(const YAML::Mark&, const std::string&, const std::string& value) override {
+		this->native();
+		_text = value;
+	}
+
+protected:
+	T takeNative() override {
+		if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::filesystem::path>) {
+			return T{std::move(_text)};
+		} else if constexpr (reusesNode) {
+			_node = _text;
+			return Deserializer<T>::deserialize(_node, this->_path);
+		} else {
+			return Deserializer<T>::deserialize(YAML::Node{_text}, this->_path);
+		}
+	}
+
+private:
+	std::string _text;
+	YAML::Node  _node;
+};
+
+template<typename T>
+class SequenceSink : public NativeSink<std::vector<T>> {
+public:
+	void beginSequence(const YAML::Mark&, const std::string&) override {
+		this->native();
+		_values.clear();
+		_pending = false;
+	}
+
+	Sink& element() override {
+		if (this->isFallback()) {
+			return NativeSink<std::vector<T>>::element();
+		}
+		finish();
+		_element->at(Path{this->_path, _values.size()});
+		_pending = true;
+		return *_element;
+	}
+
+	void end() override {
+		if (this->isFallback()) {
+			return NativeSink<std::vector<T>>::end();
+		}
+		finish();
+	}
+
+protected:
+	std::vector<T> takeNative() override {
+		return std::move(_values);
+	}
+
+private:
+	void finish() {
+		if (_pending) {
+			_values.push_back(_element->take());
+			_pending = false;
+		}
+	}
+
+	std::unique_ptr<TypedSink<T>> _element{makeTypedSink<T>()};
+	std::vector<T>                _values;
+	bool                          _pending{false};
+};
+
+// Associative containers
+template<typename T>
+class MapSink : public NativeSink<T> {
+	using Key    = std::decay_t<typename T::key_type>;
+	using Mapped = std::decay_t<typename T::mapped_type>;
+
+public:
+	void beginMap(const YAML::Mark&, const std::string&) override {
+		this->native();
+		// assigning would keep the allocator of the previous map
+		_values.emplace(detail::make<T>());
+		_expectKey = true;
+		_pending   = false;
+	}
+
+	Sink& element() override {
+		if (this->isFallback()) {
+			return NativeSink<T>::element();
+		}
+		finish();
+		if (_expectKey) {
+			_expectKey = false;
+			return _keySink;
+		}
+		_expectKey = true;
+		_keyValue.emplace(_keySink.into(*_key, this->_path));
+		_value->at(Path{this->_path, _keySink.text()});
+		_pending = true;
+		return *_value;
+	}
+
+	void end() override {
+		if (this->isFallback()) {
+			return NativeSink<T>::end();
+		}
+		finish();
+	}
+
+protected:
+	T takeNative() override {
+		return _values.has_value() ? std::move(*_values) : detail::make<T>();
+	}
+
+private:
+	void finish() {
+		if (_pending) {
+			_values->emplace(std::move(*_keyValue), _value->take());
+			_pending = false;
+		}
+	}
+
+	std::unique_ptr<TypedSink<Key>>    _key{makeTypedSink<Key>()};
+	std::unique_ptr<TypedSink<Mapped>> _value{makeTypedSink<Mapped>()};
+	KeySink                            _keySink;
+	std::optional<Key>                 _keyValue;
+	std::optional<T>                   _values;
+	bool                               _expectKey{true};
+	bool                               _pending{false};
+};
+
+// Schema of a Simple-derived structure, recorded once per type
+template<typename T>
+const Schema& schemaOf() {
+	static const Schema schema = [] {
+		Schema  recorder;
+		Binding binding{recorder};
+		T{binding};
+		recorder.seal();
+		return recorder;
+	}();
+	return schema;
+}
+
+template<typename T>
+T placeholder() {
+	if constexpr (std::is_base_of_v<Simple, T>) {
+		Schema  recorder;
+		Binding binding{recorder};
+		return T{binding};
+	} else if constexpr (std::is_default_constructible_v<T>) {
+		return T{};
+	} else {
+		throw std::logic_error("Fields which are not default-constructible cannot be bound from a stream");
+	}
+}
+
+// Simple-derived structures, values of the map entries are deserialized as they come and the structure is constructed from them
+// once the map ends.
+template<typename T>
+class StructSink : public TypedSink<T> {
+public:
+	StructSink() : _schema(schemaOf<T>()), _fields(_schema.entries().size()) {
+	}
+
+	void at(const Path& path) override {
+		_path = path;
+	}
+
+	void scalar(const YAML::Mark& mark, const std::string&, const std::string&) override {
+		invalid(mark);
+	}
+
+	void null(const YAML::Mark& mark) override {
+		invalid(mark);
+	}
+
+	void beginSequence(const YAML::Mark& mark, const std::string&) override {
+		invalid(mark);
+	}
+
+	void beginMap(const YAML::Mark& mark, const std::string&) override {
+		_mark = mark;
+		_slots.clear();
+		_slots.resize(_schema.entries().size());
+		_expectKey = true;
+		_pending   = nullptr;
+	}
+
+	Sink& element() override {
+		finish();
+		if (_expectKey) {
+			_expectKey = false;
+			return _keySink;
+		}
+		_expectKey = true;
+
+		const auto index = _keySink.isScalar() ? _schema.indexOf(_keySink.text()) : Schema::npos;
+		if (index == Schema::npos || _slots[index]) {
+			return _skip;
+		}
+		auto& sink = fieldSink(index);
+		sink.at(Path{_path, _keySink.text()});
+		_pending      = &sink;
+		_pendingIndex = index;
+		return sink;
+	}
+
+	void end() override {
+		finish();
+	}
+
+	T take() override {
+		Binding binding{_schema, _slots, _path, _mark};
+		return T{binding};
+	}
+
+private:
+	[[noreturn]] void invalid(const YAML::Mark& mark) {
+		throw InvalidNodeType("Invalid node type " + _path, mark);
+	}
+
+	Sink& fieldSink(std::size_t index) {
+		if (!_fields[index]) {
+			_fields[index] = _schema.entries()[index].factory();
+		}
+		return *_fields[index];
+	}
+
+	void finish() {
+		if (_pending != nullptr) {
+			_slots[_pendingIndex] = _pending->release();
+			_pending              = nullptr;
+		}
+	}
+
+	const Schema&                      _schema;
+	std::vector<std::unique_ptr<Sink>> _fields;
+	Binding::Slots                     _slots;
+	KeySink                            _keySink;
+	SkipSink                           _skip;
+	Path                               _path;
+	YAML::Mark                         _mark{YAML::Mark::null_mark()};
+	Sink*                              _pending{nullptr};
+	std::size_t                        _pendingIndex{0};
+	bool                               _expectKey{true};
+};
+
+template<typename T>
+struct SinkFor {
+	using type = LeafSink<T>;
+};
+
+template<typename T>
+struct SinkFor<std::vector<T>> {
+	using type = SequenceSink<T>;
+};
+
+template<typename T>
+requires std::is_base_of_v<Simple, T>
+struct SinkFor<T> {
+	using type = StructSink<T>;
+};
+
+template<typename T>
+requires(!std::is_base_of_v<Simple, T>) && requires {
+	typename T::key_type;
+	typename T::mapped_type;
+}
+struct SinkFor<T> {
+	using type = MapSink<T>;
+};
+
+// Drives the sinks from yaml-cpp parser events. Anchored values are recorded so that aliases can be replayed.
+class Handler : public YAML::EventHandler {
+public:
+	explicit Handler(Sink& root) : _root(root) {
+	}
+
+	void OnDocumentStart(const YAML::Mark&) override {
+	}
+
+	void OnDocumentEnd() override {
+	}
+
+	void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override {
+		if (recording(anchor)) {
+			record({Event::Null, mark}, anchor);
+		}
+		target().null(mark);
+	}
+
+	void OnAlias(const YAML::Mark&, YAML::anchor_t anchor) override {
+		auto it = _anchors.find(anchor);
+		if (it == _anchors.end()) {
+			return;
+		}
+		for (const auto& event : it->second) {
+			record(event, YAML::NullAnchor);
+			dispatch(event);
+		}
+	}
+
+	void OnScalar(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, const std::string& value) override {
+		if (recording(anchor)) {
+			record({Event::Scalar, mark, tag, value}, anchor);
+		}
+		target().scalar(mark, tag, value);
+	}
+
+	void OnSequenceStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value) override {
+		if (recording(anchor)) {
+			record({Event::SequenceStart, mark, tag}, anchor);
+		}
+		begin(target(), [&](Sink& sink) { sink.beginSequence(mark, tag); });
+	}
+
+	void OnSequenceEnd() override {
+		if (recording(YAML::NullAnchor)) {
+			record({Event::End}, YAML::NullAnchor);
+		}
+		end();
+	}
+
+	void OnMapStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value) override {
+		if (recording(anchor)) {
+			record({Event::MapStart, mark, tag}, anchor);
+		}
+		begin(target(), [&](Sink& sink) { sink.beginMap(mark, tag); });
+	}
+
+	void OnMapEnd() override {
+		if (recording(YAML::NullAnchor)) {
+			record({Event::End}, YAML::NullAnchor);
+		}
+		end();
+	}
+
+private:
+	struct Event {
+		enum Type { Null, Scalar, SequenceStart, MapStart, End } type;
+		YAML::Mark  mark{YAML::Mark::null_mark()};
+		std::string tag{};
+		std::string value{};
+	};
+
+	struct Recorder {
+		YAML::anchor_t     anchor;
+		int                depth;
+		std::vector<Event> events;
+	};
+
+	Sink& target() {
+		return _stack.empty() ? _root : _stack.back()->element();
+	}
+
+	template<typename Begin>
+	void begin(Sink& sink, Begin&& start) {
+		start(sink);
+		_stack.push_back(&sink);
+	}
+
+	void end() {
+		Sink* sink = _stack.back();
+		_stack.pop_back();
+		sink->end();
+	}
+
+	void dispatch(const Event& event) {
+		switch (event.type) {
+			case Event::Null:
+				target().null(event.mark);
+				break;
+			case Event::Scalar:
+				target().scalar(event.mark, event.tag, event.value);
+				break;
+			case Event::SequenceStart:
+				begin(target(), [&](Sink& sink) { sink.beginSequence(event.mark, event.tag); });
+				break;
+			case Event::MapStart:
+				begin(target(), [&](Sink& sink) { sink.beginMap(event.mark, event.tag); });
+				break;
+			case Event::End:
+				end();
+				break;
+		}
+	}
+
+	bool recording(YAML::anchor_t anchor) const {
+		return anchor != YAML::NullAnchor || !_recorders.empty();
+	}
+
+	void record(const Event& event, YAML::anchor_t anchor) {
+		if (anchor != YAML::NullAnchor) {
+			_recorders.push_back({anchor, 0, {}});
+		}
+		for (auto it = _recorders.begin(); it != _recorders.end();) {
+			it->events.push_back(event);
+			it->depth += event.type == Event::SequenceStart || event.type == Event::MapStart ? 1 : event.type == Event::End ? -1 : 0;
+			if (it->depth == 0) {
+				_anchors[it->anchor] = std::move(it->events);
+				it                   = _recorders.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+
+	Sink&                                        _root;
+	std::vector<Sink*>                           _stack;
+	std::vector<Recorder>                        _recorders;
+	std::map<YAML::anchor_t, std::vector<Event>> _anchors;
+};
+
+// Root of streamSequence, every element of the sequence is handed to the callback and dropped as soon as it is complete
+template<typename T, typename Callback>
+class ElementSink : public Sink {
+public:
+	explicit ElementSink(Callback& callback) : _callback(callback) {
+	}
+
+	void at(const Path& path) override {
+		_path = path;
+	}
+
+	void scalar(const YAML::Mark& mark, const std::string&, const std::string&) override {
+		invalid(mark);
+	}
+
+	// like an empty sequence, as for Deserializer<std::vector<T>>
+	void null(const YAML::Mark&) override {
+	}
+
+	void beginSequence(const YAML::Mark&, const std::string&) override {
+	}
+
+	void beginMap(const YAML::Mark& mark, const std::string&) override {
+		invalid(mark);
+	}
+
+	Sink& element() override {
+		finish();
+		_element->at(Path{_path, _count});
+		_pending = true;
+		return *_element;
+	}
+
+	void end() override {
+		finish();
+	}
+
+	std::unique_ptr<Value> release() override {
+		return nullptr;
+	}
+
+	std::size_t count() const {
+		return _count;
+	}
+
+private:
+	[[noreturn]] void invalid(const YAML::Mark& mark) {
+		throw InvalidNodeType("Invalid node type " + _path, mark);
+	}
+
+	void finish() {
+		if (_pending) {
+			_pending = false;
+			std::invoke(_callback, _element->take());
+			++_count;
+		}
+	}
+
+	Callback&                     _callback;
+	std::unique_ptr<TypedSink<T>> _element{makeTypedSink<T>()};
+	Path                          _path;
+	std::size_t                   _count{0};
+	bool                          _pending{false};
+};
+
+// Binds `T` from the events of one document `emit` sends to the handler, `emit` returns false when there is no document
+template<typename T, typename Emit>
+T bindEvents(Emit&& emit, const Path& path) {
+	auto    sink = makeTypedSink<T>();
+	Handler handler{*sink};
+
+	sink->at(path);
+	if (!emit(static_cast<YAML::EventHandler&>(handler))) {
+		throw MissingNode("Missing document " + path, YAML::Mark::null_mark());
+	}
+	return sink->take();
+}
+
+} // namespace stream
+
+// Binds `T` straight from parser events of the first document in the stream, no YAML::Node tree of the document is built.
+//
+// Simple-derived structures are constructed once per type to learn the keys they bind (see stream::Schema), so their
+// initializers must not depend on the values of other fields. Fields bound several times and types without a dedicated
+// streaming sink (custom Deserializers) are deserialized from a YAML::Node of just that value.
+template<typename T>
+T bindStream(std::istream& is, const Path& path = {}) {
+	YAML::Parser parser{is};
+	return stream::bindEvents<T>([&](YAML::EventHandler& handler) { return parser.HandleNextDocument(handler); }, path);
+}
+
+template<typename T>
+T bindString(const std::string& str, const Path& path = {}) {
+	std::istringstream is{str};
+	return bindStream<T>(is, path);
+}
+
+template<typename T>
+T bindFile(const std::string& filename, const Path& path = {}) {
+	std::ifstream is{filename};
+	if (!is) {
+		throw YAML::BadFile(filename);
+	}
+	return bindStream<T>(is, path);
+}
+
+template<typename T>
+T bindMappedFile(const std::string& filename, const Path& path = {}) {
+	const MappedFile file{filename};
+	MemoryStream     is{file.view()};
+	return bindStream<T>(is, path);
+}
+
+// Binds the elements of the top-level sequence of the first document one at a time and calls `callback(T&&)` with each, in
+// order, as soon as it is complete. Only the element being bound is kept in memory, so sequences far larger than the memory
+// can be processed; the document is read from the stream as it goes. Anchors are kept until the end of the document to replay
+// their aliases. Returns the number of elements, a failure of an element is thrown after the elements before it were handed
+// out. Same restrictions as bindStream.
+template<typename T, typename Callback>
+requires std::invocable<Callback&, T&&> std::size_t streamSequence(std::istream& is, Callback&& callback, const Path& path = {}) {
+	YAML::Parser                     parser{is};
+	stream::ElementSink<T, Callback> sink{callback};
+	stream::Handler                  handler{sink};
+
+	sink.at(path);
+	if (!parser.HandleNextDocument(handler)) {
+		throw MissingNode("Missing document " + path, YAML::Mark::null_mark());
+	}
+	return sink.count();
+}
+
+// Binds every document of a multi-document stream (separated by `---`) as `T` one at a time and calls `callback(T&&)` with
+// each before the next one is read. Document `i` is bound at `path[i]`. Returns the number of documents.
+template<typename T, typename Callback>
+requires std::invocable<Callback&, T&&> std::size_t forEach(std::istream& is, Callback&& callback, const Path& path = {}) {
+	YAML::Parser parser{is};
+	auto         sink = stream::makeTypedSink<T>();
+	for (std::size_t count{0};; ++count) {
+		// anchors do not outlive their document
+		stream::Handler handler{*sink};
+		const Path      documentPath{path, count};
+		sink->at(documentPath);
+		if (!parser.HandleNextDocument(handler)) {
+			return count;
+		}
+		std::invoke(callback, sink->take());
+	}
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_STREAM_HPP__
@@ -0,0 +1,141 @@
+#ifndef __SIMPLE_YAML_THREAD_POOL_HPP__
+#define __SIMPLE_YAML_THREAD_POOL_HPP__
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace simple_yaml {
+
+// Fixed number of worker threads running posted tasks in order, the number of threads bounds the parallelism of everything run on it
+class ThreadPool {
+public:
+	explicit ThreadPool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+		_workers.reserve(threads);
+		for (std::size_t i = 0; i < threads; ++i) {
+			_workers.emplace_back([this] { run(); });
+		}
+	}
+
+	ThreadPool(const ThreadPool&)            = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Finishes the tasks already posted
+	~ThreadPool() {
+		{
+			std::lock_guard lock{_mutex};
+			_stopping = true;
+		}
+		_wake.notify_all();
+		for (auto& worker : _workers) {
+			worker.join();
+		}
+	}
+
+	std::size_t size() const {
+		return _workers.size();
+	}
+
+	// Calls `body(i)` for every `i < count` on the pool and the calling thread, in chunks of `grain` indices. Indices past a
+	// failed one are skipped, the exception of the lowest failed index is rethrown once all chunks are finished.
+	template<typename Body>
+	void forEach(std::size_t count, Body&& body, std::size_t grain = 1) {
+		struct State {
+			std::atomic<std::size_t> next{0};
+			std::atomic<std::size_t> failed{none};
+			std::mutex               mutex;
+			std::condition_variable  finished;
+			std::size_t              done{0};
+			std::exception_ptr       error;
+		};
+
+		if (count == 0) {
+			return;
+		}
+		grain                    = std::max<std::size_t>(1, grain);
+		const std::size_t chunks = (count + grain - 1) / grain;
+		auto              state  = std::make_shared<State>();
+
+		// Helpers which start after the last chunk was claimed touch only the shared state
+		auto work = [state, &body, count, grain, chunks] {
+			for (std::size_t chunk; (chunk = state->next.fetch_add(1)) < chunks;) {
+				const std::size_t end = std::min(count, (chunk + 1) * grain);
+				for (std::size_t i = chunk * grain; i < end && i < state->failed.load(std::memory_order_relaxed); ++i) {
+					try {
+						body(i);
+					} catch (...) {
+						std::lock_guard lock{state->mutex};
+						if (i < state->failed.load()) {
+							state->failed.store(i);
+							state->error = std::current_exception();
+						}
+						break;
+					}
+				}
+				std::lock_guard lock{state->mutex};
+				if (++state->done == chunks) {
+					state->finished.notify_all();
+				}
+			}
+		};
+
+		for (std::size_t i = 1, helpers = std::min(size(), chunks - 1); i <= helpers; ++i) {
+			post(work);
+		}
+		work();
+
+		std::unique_lock lock{state->mutex};
+		state->finished.wait(lock, [&] { return state->done == chunks; });
+		if (state->error) {
+			std::rethrow_exception(state->error);
+		}
+	}
+
+	// The task must not throw
+	void post(std::function<void()> task) {
+		{
+			std::lock_guard lock{_mutex};
+			_tasks.push_back(std::move(task));
+		}
+		_wake.notify_one();
+	}
+
+private:
+	static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+	void run() {
+		for (;;) {
+			std::function<void()> task;
+			{
+				std::unique_lock lock{_mutex};
+				_wake.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+				if (_tasks.empty()) {
+					return;
+				}
+				task = std::move(_tasks.front());
+				_tasks.pop_front();
+			}
+			task();
+		}
+	}
+
+	std::mutex                        _mutex;
+	std::condition_variable           _wake;
+	std::deque<std::function<void()>> _tasks;
+	bool                              _stopping{false};
+	std::vector<std::thread>          _workers;
+};
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_THREAD_POOL_HPP__
@@ -0,0 +1,112 @@
+#ifndef __SIMPLE_YAML_TRACE_HPP__
+#define __SIMPLE_YAML_TRACE_HPP__
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "Path.hpp"
+
+namespace simple_yaml {
+
+// Binding of one field, as reported to a Tracer
+struct FieldTrace {
+	const Path&              path;
+	std::string_view         type;       // pretty name of the type the field is converted to
+	std::chrono::nanoseconds elapsed;    // conversion and rules, nested fields included
+	std::chrono::nanoseconds validation; // rules of this field only
+	std::size_t              scalars;    // scalar nodes converted, nested fields included
+};
+
+// Opt-in instrumentation of binding.
+//
+// Tracing is compiled in only when SIMPLE_YAML_TRACING is defined, for the whole program as it changes inline functions. Without
+// it the hooks are empty and Tracer::Scope has no effect. While a Tracer::Scope is alive on the binding thread, every field bound
+// on it is reported once it is converted and validated, nested fields before the field containing them. Fields of containers
+// deserialized on a pool (see Parallel) are not reported.
+class Tracer {
+public:
+	class Scope {
+	public:
+		explicit Scope(Tracer& tracer) : _previous(std::exchange(_current, &tracer)) {
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_current = _previous;
+		}
+
+	private:
+		Tracer* _previous;
+	};
+
+	virtual ~Tracer() = default;
+
+	virtual void field(const FieldTrace& trace) = 0;
+
+	static Tracer* current() {
+		return _current;
+	}
+
+private:
+	static inline thread_local Tracer* _current{nullptr};
+};
+
+namespace detail {
+
+#ifdef SIMPLE_YAML_TRACING
+inline constexpr bool tracing = true;
+#else
+inline constexpr bool tracing = false;
+#endif
+
+// Counters of the field being traced on this thread
+struct TraceCounters {
+	static inline thread_local std::size_t              scalars{0};
+	static inline thread_local std::chrono::nanoseconds validation{0};
+};
+
+// Called by deserializers of scalars
+inline void traceScalar() {
+	if constexpr (tracing) {
+		++TraceCounters::scalars;
+	}
+}
+
+// Adds the time of the rules to the field being traced
+class ValidationTimer {
+public:
+	ValidationTimer() {
+		if constexpr (tracing) {
+			if (Tracer::current() != nullptr) {
+				_start  = std::chrono::steady_clock::now();
+				_active = true;
+			}
+		}
+	}
+
+	ValidationTimer(const ValidationTimer&)            = delete;
+	ValidationTimer& operator=(const ValidationTimer&) = delete;
+
+	~ValidationTimer() {
+		if constexpr (tracing) {
+			if (_active) {
+				TraceCounters::validation += std::chrono::steady_clock::now() - _start;
+			}
+		}
+	}
+
+private:
+	std::chrono::steady_clock::time_point _start;
+	bool                                  _active{false};
+};
+
+} // namespace detail
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_TRACE_HPP__
@@ -0,0 +1,246 @@
+#ifndef __SIMPLE_YAML_TRY_DESERIALIZER_HPP__
+#define __SIMPLE_YAML_TRY_DESERIALIZER_HPP__
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <filesystem>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Enum.hpp"
+#include "Expected.hpp"
+#include "Memory.hpp"
+#include "Number.hpp"
+#include "Parser.hpp"
+#include "Path.hpp"
+#include "Trace.hpp"
+
+namespace simple_yaml {
+
+// Exception-free counterpart of Deserializer, failures are returned as an Error
+template<typename T>
+struct TryDeserializer {
+	//static_assert(false, "Unsopported type, you need to implement TryDeserializer.");
+};
+
+template<typename T>
+concept tryDeserializable_v = requires(const YAML::Node& n, const Path& path) {
+	{ TryDeserializer<T>::deserialize(n, path) } -> std::same_as<Expected<T>>;
+};
+
+namespace detail {
+
+inline Unexpected failure(Error::Kind kind, const Path& path, const YAML::Node& n, std::string text = {}) {
+	return Unexpected{Error{kind, path, n.Mark(), std::move(text)}};
+}
+
+// Error of a node which is not a scalar, none when it is one
+inline std::optional<Error> notScalar(const YAML::Node& n, const Path& path) {
+	if (!n.IsDefined()) {
+		return Error{Error::Kind::MissingNode, path, n.Mark(), {}};
+	}
+	if (!n.IsScalar()) {
+		return Error{Error::Kind::InvalidNodeType, path, n.Mark(), {}};
+	}
+	traceScalar();
+	return std::nullopt;
+}
+
+inline Unexpected failure(Conversion result, const Path& path, const YAML::Node& n) {
+	return failure(result == Conversion::OutOfRange ? Error::Kind::OutOfRange : Error::Kind::InvalidValue, path, n, n.Scalar());
+}
+
+// First failure of the structure being bound by Simple::tryBind, its fields stop converting once there is one
+class TryBind {
+public:
+	class Scope {
+	public:
+		explicit Scope(std::optional<Error>& failure) : _previous(std::exchange(_failure, &failure)) {
+		}
+
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope() {
+			_failure = _previous;
+		}
+
+	private:
+		std::optional<Error>* _previous;
+	};
+
+	static std::optional<Error>* failure() {
+		return _failure;
+	}
+
+private:
+	static inline thread_local std::optional<Error>* _failure{nullptr};
+};
+
+} // namespace detail
+
+template<typename T>
+requires std::is_integral_v<T> || std::is_floating_point_v<T>
+struct TryDeserializer<T> {
+	static Expected<T> deserialize(const YAML::Node& n, const Path& path) {
+		if (auto error = detail::notScalar(n, path)) {
+			return Unexpected{std::move(*error)};
+		}
+		const std::string& text = n.Scalar();
+		T                  value{};
+		detail::Conversion result;
+		if constexpr (std::is_same_v<T, bool>) {
+			result = detail::parseBool(text, value);
+		} else if constexpr (detail::isNumber<T>) {
+			result = detail::parseNumber(text, value);
+		} else {
+			// character types hold one character, like yaml-cpp reads them
+			result = text.size() == 1 ? detail::Conversion::Ok : detail::Conversion::Invalid;
+			value  = text.size() == 1 ? static_cast<T>(text.front()) : T{};
+		}
+		if (result != detail::Conversion::Ok) {
+			return detail::failure(result, path, n);
+		}
+		return value;
+	}
+};
+
+#if defined(__has_include) && __has_include(<magic_enum.hpp>)
+
+template<typename T>
+requires std::is_enum_v<T>
+struct TryDeserializer<T> {
+	static Expected<T> deserialize(const YAML::Node& n, const Path& path) {
+		if (auto error = detail::notScalar(n, path)) {
+			return Unexpected{std::move(*error)};
+		}
+		if (auto value = detail::EnumNames<T>::find(n.Scalar())) {
+			return *value;
+		}
+		return detail::failure(detail::Conversion::Invalid, path, n);
+	}
+};
+
+#endif
+
+template<typename Rep, typename Period>
+struct TryDeserializer<std::chrono::duration<Rep, Period>> {
+	static Expected<std::chrono::duration<Rep, Period>> deserialize(const YAML::Node& n, const Path& path) {
+		if (auto error = detail::notScalar(n, path)) {
+			return Unexpected{std::move(*error)};
+		}
+		const std::string_view string = n.Scalar();
+		Rep                    count;
+		if (auto [ptr, ec] = std::from_chars(string.data(), string.data() + string.size(), count); ec == std::errc() && ptr == string.data() + string.size()) {
+			return std::chrono::duration<Rep, Period>{count};
+		}
+		std::chrono::duration<Rep, Period> value;
+		if (const auto result = DurationParser<std::chrono::duration<Rep, Period>>::tryParse(string, value); result != detail::Conversion::Ok) {
+			return detail::failure(result, path, n);
+		}
+		return value;
+	}
+};
+
+template<typename T>
+requires std::is_same_v<T, std::string> || std::is_same_v<T, std::pmr::string> || std::is_same_v<T, std::filesystem::path>
+struct TryDeserializer<T> {
+	static Expected<T> deserialize(const YAML::Node& n, const Path& path) {
+		if (auto error = detail::notScalar(n, path)) {
+			return Unexpected{std::move(*error)};
+		}
+		return detail::make<T>(n.Scalar());
+	}
+};
+
+template<typename T, size_t N>
+requires tryDeserializable_v<T>
+struct TryDeserializer<std::array<T, N>> {
+	static Expected<std::array<T, N>> deserialize(const YAML::Node& n, const Path& path) {
+		if (!n.IsDefined()) {
+			return detail::failure(Error::Kind::MissingNode, path, n);
+		}
+		if (!n.IsSequence() || n.size() != N) {
+			return detail::failure(Error::Kind::InvalidNodeType, path, n);
+		}
+		std::array<T, N> ret;
+		size_t           i{0};
+		for (const auto& in : n) {
+			auto element = TryDeserializer<T>::deserialize(in, Path{path, i});
+			if (!element) {
+				return Unexpected{std::move(element).error()};
+			}
+			ret[i++] = std::move(*element);
+		}
+		return ret;
+	}
+};
+
+template<typename T, typename Allocator>
+requires tryDeserializable_v<T>
+struct TryDeserializer<std::vector<T, Allocator>> {
+	static Expected<std::vector<T, Allocator>> deserialize(const YAML::Node& n, const Path& path) {
+		if (!n.IsDefined()) {
+			return detail::failure(Error::Kind::MissingNode, path, n);
+		}
+		if (!n.IsSequence()) {
+			return detail::failure(Error::Kind::InvalidNodeType, path, n);
+		}
+		auto ret = detail::make<std::vector<T, Allocator>>();
+		ret.reserve(n.size());
+		size_t i{0};
+		for (const auto& in : n) {
+			auto element = TryDeserializer<T>::deserialize(in, Path{path, i++});
+			if (!element) {
+				return Unexpected{std::move(element).error()};
+			}
+			ret.push_back(std::move(*element));
+		}
+		return ret;
+	}
+};
+
+// Associative containers
+template<typename T>
+requires tryDeserializable_v<std::decay_t<typename T::key_type>> && tryDeserializable_v<std::decay_t<typename T::mapped_type>>
+struct TryDeserializer<T> {
+	static Expected<T> deserialize(const YAML::Node& n, const Path& path) {
+		if (!n.IsDefined()) {
+			return detail::failure(Error::Kind::MissingNode, path, n);
+		}
+		if (!n.IsMap()) {
+			return detail::failure(Error::Kind::InvalidNodeType, path, n);
+		}
+		T result = detail::make<T>();
+		for (YAML::const_iterator it = n.begin(); it != n.end(); ++it) {
+			auto key = TryDeserializer<std::decay_t<typename T::key_type>>::deserialize(it->first, path);
+			if (!key) {
+				return Unexpected{std::move(key).error()};
+			}
+			auto value = TryDeserializer<std::decay_t<typename T::mapped_type>>::deserialize(it->second, Path{path, it->first.Scalar()});
+			if (!value) {
+				return Unexpected{std::move(value).error()};
+			}
+			result.emplace(std::move(*key), std::move(*value));
+		}
+		return result;
+	}
+};
+
+// Converts the node without throwing, for the types with a TryDeserializer
+template<typename T>
+requires tryDeserializable_v<T> Expected<T> tryDeserialize(const YAML::Node& n, const Path& path = {}) {
+	return TryDeserializer<T>::deserialize(n, path);
+}
+
+} // namespace simple_yaml
+
+#endif // __SIMPLE_YAML_TRY_DESERIALIZER_HPP__
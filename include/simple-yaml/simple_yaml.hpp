@@ -2,7 +2,12 @@
 #ifndef __SIMPLE_YAML_SIMPLE_YAML_HPP__
 #	define __SIMPLE_YAML_SIMPLE_YAML_HPP__
 
+#	include "CompiledCache.hpp"
+#	include "Document.hpp"
 #	include "Exception.hpp"
+#	include "Files.hpp"
+#	include "Instantiations.hpp"
+#	include "Serializer.hpp"
 #	include "Simple.hpp"
 
 #endif
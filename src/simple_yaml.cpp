@@ -0,0 +1,4 @@
+#include "simple-yaml/simple_yaml.hpp"
+
+// Definitions of the instantiations SIMPLE_YAML_PRECOMPILED translation units only declare (see Instantiations.hpp)
+SIMPLE_YAML_COMMON_TYPES(SIMPLE_YAML_INSTANTIATE)
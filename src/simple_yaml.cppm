@@ -0,0 +1,87 @@
+module;
+
+#include "simple-yaml/simple_yaml.hpp"
+
+// The headers stay in the global module fragment, importers get the names below and the yaml-cpp types of their signatures
+export module simple_yaml;
+
+export namespace simple_yaml {
+using simple_yaml::Arena;
+using simple_yaml::CompiledCache;
+using simple_yaml::Detach;
+using simple_yaml::Deserializer;
+using simple_yaml::Document;
+using simple_yaml::DurationParser;
+using simple_yaml::Emitter;
+using simple_yaml::Field;
+using simple_yaml::FixedString;
+using simple_yaml::Footprint;
+using simple_yaml::Includes;
+using simple_yaml::Keyed;
+using simple_yaml::KeyIndex;
+using simple_yaml::Loaded;
+using simple_yaml::MappedFile;
+using simple_yaml::Memory;
+using simple_yaml::Parallel;
+using simple_yaml::Path;
+using simple_yaml::RegexCache;
+using simple_yaml::Reload;
+using simple_yaml::Reloader;
+using simple_yaml::Serializer;
+using simple_yaml::Simple;
+using simple_yaml::StaticRegex;
+using simple_yaml::ThreadPool;
+using simple_yaml::TryDeserializer;
+
+using simple_yaml::deserializable_v;
+using simple_yaml::serializable_v;
+using simple_yaml::tryDeserializable_v;
+
+using simple_yaml::bindAllocated;
+using simple_yaml::bindCollecting;
+using simple_yaml::bindDetached;
+using simple_yaml::bindFile;
+using simple_yaml::bindMappedFile;
+using simple_yaml::bindStream;
+using simple_yaml::bindString;
+using simple_yaml::fingerprint;
+using simple_yaml::footprint;
+using simple_yaml::forEach;
+using simple_yaml::fromFile;
+using simple_yaml::fromFiles;
+using simple_yaml::fromMappedFile;
+using simple_yaml::fromStream;
+using simple_yaml::fromString;
+using simple_yaml::loadAll;
+using simple_yaml::streamSequence;
+using simple_yaml::toFile;
+using simple_yaml::toString;
+using simple_yaml::tryDeserialize;
+using simple_yaml::tryFromString;
+
+// Errors
+using simple_yaml::Collected;
+using simple_yaml::Diagnostic;
+using simple_yaml::Diagnostics;
+using simple_yaml::Error;
+using simple_yaml::Exception;
+using simple_yaml::Expected;
+using simple_yaml::InvalidNode;
+using simple_yaml::InvalidNodeType;
+using simple_yaml::InvalidValue;
+using simple_yaml::MissingNode;
+using simple_yaml::OutOfRange;
+using simple_yaml::RuntimeError;
+using simple_yaml::Unexpected;
+using simple_yaml::operator<<;
+
+// Tracing
+using simple_yaml::FieldTrace;
+using simple_yaml::Tracer;
+} // namespace simple_yaml
+
+export namespace YAML {
+using YAML::Mark;
+using YAML::Node;
+using YAML::NodeType;
+} // namespace YAML
@@ -0,0 +1,102 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Calibration : Simple {
+	using Simple::Simple;
+
+	std::vector<double>       weights = bound("weights");
+	std::vector<float>        gains   = bound("gains");
+	std::vector<int64_t>      offsets = bound("offsets");
+	std::vector<uint16_t>     ports   = bound("ports");
+	std::array<double, 3>     origin  = bound("origin");
+	std::array<int, 4>        window  = bound("window");
+	std::vector<char>         codes   = bound("codes");
+	std::vector<bool>         enabled = bound("enabled");
+};
+
+static const std::string source{R"(
+weights: [0.125, -1.5, 3e-2, 1e10, .5, 2.]
+gains: [1.25, 0.1]
+offsets: [0, -9223372036854775808, 9223372036854775807]
+ports: [80, 443, 65535]
+origin: [1.5, -2.25, 0]
+window: [0, 0, 1920, 1080]
+codes: [a, b]
+enabled: [true, false]
+)"};
+
+TEST(Bulk, Numbers) {
+	const Calibration config{fromString(source)};
+
+	EXPECT_EQ(config.weights, (std::vector<double>{0.125, -1.5, 3e-2, 1e10, .5, 2.}));
+	EXPECT_EQ(config.gains, (std::vector<float>{1.25f, 0.1f}));
+	EXPECT_EQ(config.offsets, (std::vector<int64_t>{0, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()}));
+	EXPECT_EQ(config.ports, (std::vector<uint16_t>{80, 443, 65535}));
+	EXPECT_EQ(config.origin, (std::array<double, 3>{1.5, -2.25, 0}));
+	EXPECT_EQ(config.window, (std::array<int, 4>{0, 0, 1920, 1080}));
+	EXPECT_EQ(config.codes, (std::vector<char>{'a', 'b'}));
+	EXPECT_EQ(config.enabled, (std::vector<bool>{true, false}));
+}
+
+// Every spelling gives the same result or error in a sequence as a single value
+template<typename T>
+static void expectSameAsSingle(const std::string& scalar) {
+	const auto element = YAML::Load(scalar);
+	const auto node    = YAML::Load("[" + scalar + "]");
+
+	std::optional<T> single;
+	try {
+		single = Deserializer<T>::deserialize(element, "/");
+	} catch (const YAML::BadConversion&) {
+	}
+
+	if (!single) {
+		EXPECT_THROW(Deserializer<std::vector<T>>::deserialize(node, "/"), YAML::TypedBadConversion<T>) << scalar;
+		return;
+	}
+	const auto bulk = Deserializer<std::vector<T>>::deserialize(node, "/");
+	ASSERT_EQ(bulk.size(), 1) << scalar;
+	if constexpr (std::is_floating_point_v<T>) {
+		if (std::isnan(*single)) {
+			EXPECT_TRUE(std::isnan(bulk[0])) << scalar;
+			return;
+		}
+	}
+	EXPECT_EQ(bulk[0], *single) << scalar;
+}
+
+TEST(Bulk, SameAsSingleValues) {
+	for (const std::string scalar : {"+7", ".inf", "-.Inf", ".NaN", "' 5'", "'5 '", "1e400", "inf", "nan", "12abc", "0x1A", "-0", "1.", "007"}) {
+		expectSameAsSingle<double>(scalar);
+		expectSameAsSingle<float>(scalar);
+		expectSameAsSingle<int>(scalar);
+		expectSameAsSingle<unsigned>(scalar);
+	}
+	for (const std::string scalar : {"-1", "99999999999", "65536", "255"}) {
+		expectSameAsSingle<int>(scalar);
+		expectSameAsSingle<uint16_t>(scalar);
+		expectSameAsSingle<int64_t>(scalar);
+	}
+
+	EXPECT_THROW((Deserializer<std::array<uint16_t, 2>>::deserialize(YAML::Load("[1, 65536]"), "/")), YAML::TypedBadConversion<uint16_t>);
+}
+
+TEST(Bulk, ErrorPath) {
+	try {
+		Deserializer<std::vector<int>>::deserialize(YAML::Load("[1, 2, [3]]"), "/values");
+		FAIL();
+	} catch (const InvalidNodeType& e) {
+		EXPECT_NE(std::string{e.what()}.find("/values[2]"), std::string::npos) << e.what();
+	}
+
+	EXPECT_THROW((Deserializer<std::array<int, 2>>::deserialize(YAML::Load("[1, 2, 3]"), "/")), InvalidNode);
+}
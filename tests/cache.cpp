@@ -0,0 +1,109 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+static const std::string source{R"(
+name: cached
+base: &base
+  weight: 2
+replicas:
+  - *base
+  - weight: 5
+labels: {tier: web, zone: eu}
+)"};
+
+struct Replica : Simple {
+	using Simple::Simple;
+
+	int weight = bound("weight").addRuleMinimum(1);
+};
+
+struct CachedConfig : Simple {
+	using Simple::Simple;
+
+	std::string                        name     = bound("name");
+	std::vector<Replica>               replicas = bound("replicas");
+	std::map<std::string, std::string> labels   = bound("labels");
+};
+
+struct NameOnly : Simple {
+	using Simple::Simple;
+
+	std::string name = bound("name");
+};
+
+class CompiledCacheTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::filesystem::remove_all(directory);
+		write(source);
+	}
+
+	void TearDown() override {
+		std::filesystem::remove_all(directory);
+		std::filesystem::remove(file);
+	}
+
+	void write(const std::string& content) const {
+		std::ofstream{file, std::ios::binary | std::ios::trunc} << content;
+	}
+
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "simple_yaml_cache";
+	const std::filesystem::path file      = std::filesystem::temp_directory_path() / "simple_yaml_cached.yaml";
+};
+
+TEST_F(CompiledCacheTest, HitAfterFirstLoad) {
+	CompiledCache cache{directory};
+
+	const auto first  = cache.bind<CachedConfig>(file.string());
+	const auto second = cache.bind<CachedConfig>(file.string());
+	EXPECT_EQ(cache.misses(), 1);
+	EXPECT_EQ(cache.hits(), 1);
+	EXPECT_TRUE(std::filesystem::exists(cache.snapshotOf(file.string())));
+
+	EXPECT_EQ(second.name, "cached");
+	ASSERT_EQ(second.replicas.size(), 2);
+	EXPECT_EQ(second.replicas[0].weight, 2);
+	EXPECT_EQ(second.replicas[1].weight, 5);
+	EXPECT_EQ(second.labels, first.labels);
+
+	CompiledCache other{directory};
+	EXPECT_EQ(other.bind<NameOnly>(file.string()).name, "cached");
+	EXPECT_EQ(other.hits(), 1);
+}
+
+TEST_F(CompiledCacheTest, ChangedFileIsReparsed) {
+	CompiledCache cache{directory};
+	cache.bind<CachedConfig>(file.string());
+
+	write("name: changed\nreplicas: []\nlabels: {}\n");
+	EXPECT_EQ(cache.bind<CachedConfig>(file.string()).name, "changed");
+	EXPECT_EQ(cache.misses(), 2);
+	EXPECT_EQ(cache.bind<CachedConfig>(file.string()).name, "changed");
+	EXPECT_EQ(cache.hits(), 1);
+}
+
+TEST_F(CompiledCacheTest, CorruptedSnapshotIsRebuilt) {
+	CompiledCache cache{directory};
+	cache.bind<CachedConfig>(file.string());
+
+	std::filesystem::resize_file(cache.snapshotOf(file.string()), 40);
+	EXPECT_EQ(cache.bind<CachedConfig>(file.string()).name, "cached");
+	EXPECT_EQ(cache.misses(), 2);
+	EXPECT_EQ(cache.bind<CachedConfig>(file.string()).name, "cached");
+	EXPECT_EQ(cache.hits(), 1);
+}
+
+TEST_F(CompiledCacheTest, ErrorsOnHit) {
+	write("name: cached\nreplicas: [{weight: 0}]\nlabels: {}\n");
+	CompiledCache cache{directory};
+	EXPECT_EQ(cache.bind<NameOnly>(file.string()).name, "cached");
+	EXPECT_THROW(cache.bind<CachedConfig>(file.string()), ValidatorFailed);
+	EXPECT_EQ(cache.hits(), 1);
+}
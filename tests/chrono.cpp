@@ -23,3 +23,41 @@ TEST(Chrono, Equality) {
 	EXPECT_EQ(config.dayLong, std::chrono::days{1});
 	EXPECT_EQ(config.dayShort, std::chrono::minutes{24 * 60});
 }
+
+TEST(Chrono, Units) {
+	using namespace std::chrono;
+
+	EXPECT_EQ(DurationParser<nanoseconds>::parse("7ns"), nanoseconds{7});
+	EXPECT_EQ(DurationParser<nanoseconds>::parse("7us"), microseconds{7});
+	EXPECT_EQ(DurationParser<nanoseconds>::parse("7ms"), milliseconds{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7s"), seconds{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7m"), minutes{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7h"), hours{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7d"), days{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7w"), weeks{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7M"), months{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7mo"), months{7});
+	EXPECT_EQ(DurationParser<seconds>::parse("7y"), years{7});
+}
+
+TEST(Chrono, Compound) {
+	using namespace std::chrono;
+
+	EXPECT_EQ(DurationParser<seconds>::parse("1d 2h 30m 10s"), days{1} + hours{2} + minutes{30} + seconds{10});
+	EXPECT_EQ(DurationParser<seconds>::parse("1h30m"), minutes{90});
+	EXPECT_EQ(DurationParser<seconds>::parse("1h -10m"), minutes{50});
+	EXPECT_EQ(DurationParser<seconds>::parse("1s 999ms"), seconds{1});
+	EXPECT_EQ(DurationParser<seconds>::parse(""), seconds{0});
+}
+
+TEST(Chrono, Invalid) {
+	using namespace std::chrono;
+
+	EXPECT_THROW(DurationParser<seconds>::parse("10x"), std::runtime_error);
+	EXPECT_THROW(DurationParser<seconds>::parse("10"), std::runtime_error);
+	EXPECT_THROW(DurationParser<seconds>::parse("h"), std::runtime_error);
+	EXPECT_THROW(DurationParser<seconds>::parse("1h, 2m"), std::runtime_error);
+	EXPECT_THROW(DurationParser<nanoseconds>::parse("1000y"), std::overflow_error);
+	EXPECT_THROW(DurationParser<seconds>::parse("99999999999999999999s"), std::overflow_error);
+	EXPECT_THROW(DurationParser<duration<int32_t>>::parse("100y"), std::overflow_error);
+}
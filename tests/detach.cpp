@@ -0,0 +1,68 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Worker : Simple {
+	using Simple::Simple;
+
+	std::string name    = bound("name");
+	int         threads = bound("threads", 1);
+};
+
+struct Daemon : Simple {
+	using Simple::Simple;
+
+	std::string         name    = bound("name");
+	std::vector<Worker> workers = bound("workers");
+};
+
+static std::string generate(std::size_t count) {
+	std::string source = "name: collector\nworkers:\n";
+	for (std::size_t i = 0; i < count; ++i) {
+		source += "  - {name: worker-" + std::to_string(i) + ", threads: " + std::to_string(i % 8 + 1) + "}\n";
+	}
+	return source;
+}
+
+TEST(Detach, ReleasesDocument) {
+	const auto root = fromString(generate(100));
+
+	const Daemon attached{root};
+	EXPECT_EQ(attached.retained().nodes, footprint(root).nodes);
+	EXPECT_EQ(attached.retained().nodes, 1 + 4 + 100 * 5);
+	EXPECT_GT(attached.retained().bytes, attached.retained().nodes * sizeof(YAML::detail::node_data));
+	EXPECT_GT(attached.workers[7].retained().nodes, 0);
+
+	const auto detached = bindDetached<Daemon>(root);
+	EXPECT_EQ(detached.name, "collector");
+	ASSERT_EQ(detached.workers.size(), 100);
+	EXPECT_EQ(detached.workers[7].name, "worker-7");
+	EXPECT_EQ(detached.workers[7].threads, 8);
+	EXPECT_EQ(detached.retained().nodes, 0);
+	EXPECT_EQ(detached.retained().bytes, 0);
+	for (const auto& worker : detached.workers) {
+		EXPECT_EQ(worker.retained().bytes, 0);
+	}
+
+	EXPECT_FALSE(Detach::active());
+}
+
+TEST(Detach, ParallelAndManual) {
+	const auto root = fromString(generate(300));
+
+	ThreadPool      pool{2};
+	Parallel::Scope parallel{pool, 16};
+	const auto      detached = bindDetached<Daemon>(root);
+	ASSERT_EQ(detached.workers.size(), 300);
+	for (const auto& worker : detached.workers) {
+		EXPECT_EQ(worker.retained().nodes, 0);
+	}
+
+	Worker worker{fromString("{name: manual}")};
+	worker.detach();
+	EXPECT_EQ(worker.name, "manual");
+	EXPECT_EQ(worker.retained().nodes, 0);
+}
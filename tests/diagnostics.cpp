@@ -0,0 +1,81 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Listener : Simple {
+	using Simple::Simple;
+
+	std::string address = bound("address");
+	int         port    = bound("port").addRuleRange(1, 65535);
+};
+
+struct Site : Simple {
+	using Simple::Simple;
+
+	std::string                name      = bound("name").addRuleLengthMinimum(3);
+	int                        workers   = bound("workers", 4);
+	Listener                   primary   = bound("primary");
+	std::vector<Listener>      listeners = bound("listeners");
+	std::map<std::string, int> limits    = bound("limits");
+	std::vector<int>           ports     = bound("ports");
+};
+
+static const std::string broken{R"(
+name: ab
+workers: many
+primary: [not, a, map]
+listeners:
+  - {address: a, port: 80}
+  - {address: b, port: 0}
+  - {port: 443}
+  - 7
+limits: {connections: 10, requests: lots}
+ports: [1, x, 3]
+)"};
+
+TEST(Diagnostics, CollectsAll) {
+	const auto result = bindCollecting<Site>(fromString(broken));
+	ASSERT_TRUE(result.value.has_value());
+
+	std::vector<std::string> paths;
+	for (const auto& error : result.errors) {
+		paths.push_back(error.path);
+	}
+	EXPECT_EQ(paths, (std::vector<std::string>{"/name", "/workers", "/primary", "/listeners[1]/port", "/listeners[2]/address", "/listeners[3]",
+	                                           "/limits/requests", "/ports[1]"}));
+
+	const auto& site = *result.value;
+	EXPECT_EQ(site.name, "ab");   // a failed rule keeps the value
+	EXPECT_EQ(site.workers, 4);   // the default value
+	EXPECT_TRUE(site.primary.address.empty());
+	ASSERT_EQ(site.listeners.size(), 3);
+	EXPECT_EQ(site.listeners[1].port, 0);
+	EXPECT_EQ(site.listeners[2].port, 443);
+	EXPECT_EQ(site.limits, (std::map<std::string, int>{{"connections", 10}}));
+	EXPECT_EQ(site.ports, (std::vector<int>{1, 3}));
+
+	EXPECT_NE(result.errors[1].message.find("many"), std::string::npos) << result.errors[1].message;
+	EXPECT_EQ(result.errors[1].mark.line, 2);
+	EXPECT_EQ(result.errors[7].mark.line, 10);
+}
+
+TEST(Diagnostics, ValidDocument) {
+	const auto result = bindCollecting<Listener>(fromString("{address: a, port: 1}"));
+	EXPECT_TRUE(result.errors.empty());
+	EXPECT_EQ(result.value->port, 1);
+
+	// the same document still throws the first failure outside of collecting
+	EXPECT_THROW(Site{fromString(broken)}, ValidatorFailed);
+	EXPECT_EQ(Diagnostics::current(), nullptr);
+}
+
+TEST(Diagnostics, RootFailure) {
+	const auto result = bindCollecting<Site>(fromString("[1, 2]"));
+	EXPECT_FALSE(result.value.has_value());
+	ASSERT_EQ(result.errors.size(), 1);
+	EXPECT_EQ(result.errors[0].mark.line, 0);
+}
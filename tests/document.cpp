@@ -0,0 +1,68 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace simple_yaml;
+
+static const std::string source{R"(
+name: service
+escaped: "tab\tand \"quotes\""
+folded: >
+  folded
+  text
+routes: [/api, /health, /metrics]
+ports: [80, 443]
+)"};
+
+struct Views : Simple {
+	using Simple::Simple;
+
+	std::string_view                  name       = bound("name");
+	std::string_view                  escaped    = bound("escaped");
+	std::string_view                  folded     = bound("folded");
+	std::string_view                  missing    = bound("missing", std::string_view{"default"});
+	std::vector<std::string_view>     routes     = bound("routes");
+	std::span<const std::string_view> spanRoutes = bound("routes");
+	std::span<const int>              ports      = bound("ports");
+};
+
+TEST(Document, StringViews) {
+	auto       document = Document::fromString(std::string{source});
+	const auto config   = document.bind<Views>();
+
+	EXPECT_EQ(config.name, "service");
+	EXPECT_EQ(config.escaped, "tab\tand \"quotes\"");
+	EXPECT_EQ(config.folded, "folded text\n");
+	EXPECT_EQ(config.missing, "default");
+	ASSERT_EQ(config.routes.size(), 3);
+	EXPECT_EQ(config.routes[1], "/health");
+	EXPECT_EQ(config.name.data(), document.root()["name"].Scalar().data());
+}
+
+TEST(Document, Spans) {
+	auto       document = Document::fromString(source);
+	const auto config   = document.bind<Views>();
+
+	ASSERT_EQ(config.spanRoutes.size(), 3);
+	EXPECT_EQ(config.spanRoutes[2], "/metrics");
+	ASSERT_EQ(config.ports.size(), 2);
+	EXPECT_EQ(config.ports[0], 80);
+	EXPECT_EQ(config.ports[1], 443);
+	EXPECT_EQ(document.arena().blocks(), 2);
+
+	auto moved = std::move(document);
+	EXPECT_EQ(config.ports[1], 443);
+	EXPECT_EQ(moved.arena().blocks(), 2);
+}
+
+TEST(Document, RequiresDocument) {
+	auto unbound = [] {
+		struct : Simple {
+			std::string_view name = bound("name");
+		} config{fromString(source)};
+	};
+
+	EXPECT_THROW(unbound(), std::logic_error);
+}
@@ -65,4 +65,39 @@ TEST(Enum, InvalidType) {
 	EXPECT_THROW(invalidEnum(), simple_yaml::InvalidNodeType);
 }
 
+// Close to the 128 values magic_enum looks at by default
+enum class State {
+	State000, State001, State002, State003, State004, State005, State006, State007, State008, State009,
+	State010, State011, State012, State013, State014, State015, State016, State017, State018, State019,
+	State020, State021, State022, State023, State024, State025, State026, State027, State028, State029,
+	State030, State031, State032, State033, State034, State035, State036, State037, State038, State039,
+	State040, State041, State042, State043, State044, State045, State046, State047, State048, State049,
+	State050, State051, State052, State053, State054, State055, State056, State057, State058, State059,
+	State060, State061, State062, State063, State064, State065, State066, State067, State068, State069,
+	State070, State071, State072, State073, State074, State075, State076, State077, State078, State079,
+	State080, State081, State082, State083, State084, State085, State086, State087, State088, State089,
+	State090, State091, State092, State093, State094, State095, State096, State097, State098, State099,
+	State100, State101, State102, State103, State104, State105, State106, State107, State108, State109,
+	State110, State111, State112, State113, State114, State115, State116, State117, State118, State119,
+};
+
+TEST(Enum, LargeEnum) {
+	for (const auto value : magic_enum::enum_values<State>()) {
+		const auto name = magic_enum::enum_name(value);
+		EXPECT_EQ(Deserializer<State>::deserialize(YAML::Node{std::string{name}}, "/state"), value) << name;
+	}
+	static_assert(detail::EnumNames<State>::find("State077") == State::State077);
+	static_assert(!detail::EnumNames<State>::find("State120").has_value());
+	static_assert(!detail::EnumNames<State>::find("state000").has_value());
+	static_assert(!detail::EnumNames<State>::find("").has_value());
+	static_assert(detail::EnumNames<Enum1>::find("B") == Enum1::B);
+
+	try {
+		Deserializer<Enum1>::deserialize(YAML::Node{"D"}, "/level");
+		FAIL();
+	} catch (const InvalidNodeType& e) {
+		EXPECT_EQ(std::string{e.what()}, "Invalid enum value \"D\" (possible: A B C) at /level");
+	}
+}
+
 #endif
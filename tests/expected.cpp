@@ -0,0 +1,109 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+enum class Protocol { Tcp, Udp };
+
+struct Socket : Simple {
+	using Simple::Simple;
+
+	std::string          host     = bound("host");
+	std::uint16_t        port     = bound("port").addRule<std::uint16_t>([](std::uint16_t port) { return port > 0; }, "port must be positive");
+	Protocol             protocol = bound("protocol", Protocol::Tcp);
+	std::chrono::seconds timeout  = bound("timeout", std::chrono::seconds{30});
+};
+
+struct Cluster : Simple {
+	using Simple::Simple;
+
+	std::string                   name    = bound("name");
+	std::vector<Socket>           sockets = bound("sockets");
+	std::map<std::string, double> weights = bound("weights", std::map<std::string, double>{});
+};
+
+template<typename T>
+static Error errorOf(const std::string& source) {
+	const auto result = Simple::tryBind<T>(fromString(source));
+	EXPECT_FALSE(result.has_value());
+	return result.has_value() ? Error{} : result.error();
+}
+
+TEST(Expected, Values) {
+	const auto cluster = Simple::tryBind<Cluster>(fromString(R"(
+name: main
+sockets:
+  - {host: a, port: 80}
+  - {host: b, port: 53, protocol: Udp, timeout: 1m 30s}
+weights: {a: 0.25}
+)"));
+	ASSERT_TRUE(cluster.has_value()) << cluster.error().message();
+	EXPECT_EQ(cluster->name, "main");
+	ASSERT_EQ(cluster->sockets.size(), 2);
+	EXPECT_EQ(cluster->sockets[0].timeout, std::chrono::seconds{30});
+	EXPECT_EQ(cluster->sockets[1].protocol, Protocol::Udp);
+	EXPECT_EQ(cluster->sockets[1].timeout, std::chrono::seconds{90});
+	EXPECT_EQ(cluster->weights.at("a"), 0.25);
+
+	EXPECT_EQ(*tryDeserialize<int>(fromString("0x1F")), 31);
+	EXPECT_EQ(*tryDeserialize<std::vector<bool>>(fromString("[yes, off]")), (std::vector<bool>{true, false}));
+	EXPECT_EQ(*tryDeserialize<char>(fromString("c")), 'c');
+}
+
+TEST(Expected, Errors) {
+	auto error = errorOf<Cluster>("{name: main, sockets: [{host: a, port: 80}, {host: b, port: 70000}]}");
+	EXPECT_EQ(error.kind, Error::Kind::OutOfRange);
+	EXPECT_EQ(error.path, "/sockets[1]/port");
+	EXPECT_EQ(error.text, "70000");
+	EXPECT_EQ(error.mark.column, 60);
+	EXPECT_EQ(error.message(), "Value \"70000\" out of range at /sockets[1]/port");
+
+	error = errorOf<Cluster>("{name: main, sockets: [{host: a, port: 0}]}");
+	EXPECT_EQ(error.kind, Error::Kind::ValidationFailed);
+	EXPECT_EQ(error.message(), "port must be positive");
+
+	error = errorOf<Cluster>("{sockets: [{host: a, port: 1}]}");
+	EXPECT_EQ(error.kind, Error::Kind::MissingNode);
+	EXPECT_EQ(error.message(), "Missing node /name");
+
+	error = errorOf<Cluster>("{name: main, sockets: [{host: a, port: 1, protocol: Sctp}]}");
+	EXPECT_EQ(error.kind, Error::Kind::InvalidValue);
+	EXPECT_EQ(error.path, "/sockets[0]/protocol");
+
+	error = errorOf<Cluster>("{name: main, sockets: [{host: a, port: 1, timeout: 1 fortnight}]}");
+	EXPECT_EQ(error.kind, Error::Kind::InvalidValue);
+
+	error = errorOf<Cluster>("{name: [main], sockets: []}");
+	EXPECT_EQ(error.kind, Error::Kind::InvalidNodeType);
+
+	EXPECT_EQ(tryDeserialize<std::int16_t>(fromString("40000")).error().kind, Error::Kind::OutOfRange);
+	EXPECT_EQ(tryDeserialize<std::vector<int>>(fromString("{a: 1}")).error().kind, Error::Kind::InvalidNodeType);
+	EXPECT_EQ(errorOf<Socket>("[1]").kind, Error::Kind::InvalidNodeType);
+}
+
+TEST(Expected, FromString) {
+	const auto parsed = tryFromString("{a: [1, 2");
+	ASSERT_FALSE(parsed.has_value());
+	EXPECT_EQ(parsed.error().kind, Error::Kind::Parse);
+	EXPECT_FALSE(parsed.error().message().empty());
+
+	const auto document = tryFromString("{host: a, port: 8080}");
+	ASSERT_TRUE(document.has_value());
+	EXPECT_EQ(Simple::tryBind<Socket>(*document)->port, 8080);
+}
+
+TEST(Expected, Durations) {
+	using namespace std::chrono;
+
+	nanoseconds value;
+	EXPECT_EQ(DurationParser<nanoseconds>::tryParse("1s 5ms", value), detail::Conversion::Ok);
+	EXPECT_EQ(value, seconds{1} + milliseconds{5});
+	EXPECT_EQ(DurationParser<nanoseconds>::tryParse("1000y", value), detail::Conversion::OutOfRange);
+	EXPECT_EQ(DurationParser<nanoseconds>::tryParse("5 parsecs", value), detail::Conversion::Invalid);
+	EXPECT_EQ(DurationParser<nanoseconds>::tryParse("ms", value), detail::Conversion::Invalid);
+}
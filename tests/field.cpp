@@ -0,0 +1,72 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace simple_yaml;
+
+namespace {
+
+struct Counted {
+	static inline int conversions{0};
+
+	int value;
+};
+
+} // namespace
+
+template<>
+struct simple_yaml::Deserializer<Counted> {
+	static Counted deserialize(const YAML::Node& n, const Path&) {
+		++Counted::conversions;
+		return Counted{n.as<int>()};
+	}
+};
+
+static const std::string source{R"(
+counted: 42
+file: /usr/share/doc
+)"};
+
+TEST(Field, ConvertsOnce) {
+	Counted::conversions = 0;
+
+	const struct : Simple {
+		using Simple::Simple;
+
+		Counted counted = bound("counted")
+		                      .addRule<Counted>([](const Counted& c) { return c.value > 0; })
+		                      .addRule<Counted>([](const Counted& c) { return c.value < 100; })
+		                      .addRule<Counted>([](const Counted& c) { return c.value % 2 == 0; });
+	} config{fromString(source)};
+
+	EXPECT_EQ(config.counted.value, 42);
+	EXPECT_EQ(Counted::conversions, 1);
+}
+
+TEST(Field, RuleOfDifferentType) {
+	const struct : Simple {
+		using Simple::Simple;
+
+		std::filesystem::path file = bound("file").addRuleLength(1, 20).addRuleRegex("^/usr/.*");
+	} config{fromString(source)};
+
+	EXPECT_EQ(config.file, std::filesystem::path{"/usr/share/doc"});
+
+	auto invalid = [] {
+		struct : Simple {
+			std::filesystem::path file = bound("file").addRuleLengthMaximum(5);
+		} config{fromString(source)};
+	};
+
+	EXPECT_THROW(invalid(), ValidatorFailed);
+}
+
+TEST(Field, RulesCheckDefaultValue) {
+	auto invalid = [] {
+		struct : Simple {
+			int missing = bound("missing", 5).addRuleMinimum(10);
+		} config{fromString(source)};
+	};
+
+	EXPECT_THROW(invalid(), ValidatorFailed);
+}
@@ -0,0 +1,80 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Fragment : Simple {
+	using Simple::Simple;
+
+	std::string name     = bound("name");
+	int         priority = bound("priority", 0);
+};
+
+class FilesTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::filesystem::create_directories(directory);
+		for (int i = 0; i < 16; ++i) {
+			paths.push_back(write("fragment" + std::to_string(i) + ".yaml", "name: fragment" + std::to_string(i) + "\npriority: " + std::to_string(i) + "\n"));
+		}
+	}
+
+	void TearDown() override {
+		std::filesystem::remove_all(directory);
+	}
+
+	std::string write(const std::string& name, const std::string& content) const {
+		const auto path = directory / name;
+		std::ofstream{path} << content;
+		return path.string();
+	}
+
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "simple_yaml_files";
+	std::vector<std::string>    paths;
+};
+
+TEST_F(FilesTest, InputOrder) {
+	ThreadPool pool{4};
+	const auto fragments = loadAll<Fragment>(paths, pool);
+	ASSERT_EQ(fragments.size(), paths.size());
+	for (std::size_t i = 0; i < fragments.size(); ++i) {
+		EXPECT_EQ(fragments[i].path(), paths[i]);
+		ASSERT_TRUE(fragments[i].ok());
+		EXPECT_EQ(fragments[i].value().name, "fragment" + std::to_string(i));
+		EXPECT_EQ(fragments[i].value().priority, static_cast<int>(i));
+	}
+
+	const auto nodes = fromFiles(paths);
+	ASSERT_EQ(nodes.size(), paths.size());
+	EXPECT_EQ(nodes[3].value()["name"].Scalar(), "fragment3");
+}
+
+TEST_F(FilesTest, ErrorsPerFile) {
+	paths.insert(paths.begin() + 2, write("broken.yaml", "priority: 1\n"));
+	paths.insert(paths.begin() + 5, (directory / "missing.yaml").string());
+	paths.push_back(write("invalid.yaml", "name: [unterminated\n"));
+
+	const auto fragments = loadAll<Fragment>(paths);
+	ASSERT_EQ(fragments.size(), paths.size());
+	EXPECT_EQ(std::count_if(fragments.begin(), fragments.end(), [](const auto& f) { return f.ok(); }), 16);
+
+	EXPECT_FALSE(fragments[2]);
+	try {
+		fragments[2].value();
+		FAIL() << "Expected MissingNode";
+	} catch (const MissingNode& e) {
+		EXPECT_EQ(std::string{e.what()}, "Missing node " + paths[2] + "/name");
+	}
+	EXPECT_THROW(fragments[5].value(), YAML::BadFile);
+	EXPECT_THROW(fragments.back().value(), YAML::ParserException);
+	EXPECT_EQ(fragments[6].value().name, "fragment4");
+}
+
+TEST(Files, Empty) {
+	EXPECT_TRUE(loadAll<int>({}).empty());
+	EXPECT_TRUE(fromFiles({}).empty());
+}
@@ -0,0 +1,135 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct CatalogueEntry : Simple {
+	using Simple::Simple;
+
+	std::string name  = bound("name");
+	int         price = bound("price");
+};
+
+struct ServiceConfig : Simple {
+	using Simple::Simple;
+
+	std::string                 service   = bound("service");
+	std::vector<CatalogueEntry> catalogue = bound("catalogue");
+};
+
+class IncludeTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::filesystem::create_directories(directory / "shared");
+		write("shared/catalogue.yaml", "- {name: disk, price: 3}\n- !include item.yaml\n");
+		write("shared/item.yaml", "{name: cpu, price: 7}\n");
+	}
+
+	void TearDown() override {
+		std::filesystem::remove_all(directory);
+	}
+
+	std::string write(const std::string& name, const std::string& content) const {
+		const auto path = directory / name;
+		std::ofstream{path} << content;
+		return path.string();
+	}
+
+	std::string config(const std::string& service) const {
+		return write(service + ".yaml", "service: " + service + "\ncatalogue: !include shared/catalogue.yaml\n");
+	}
+
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "simple_yaml_include";
+};
+
+TEST_F(IncludeTest, Subtree) {
+	const ServiceConfig config{fromFile(this->config("billing"))};
+	EXPECT_EQ(config.service, "billing");
+	ASSERT_EQ(config.catalogue.size(), 2);
+	EXPECT_EQ(config.catalogue[0].name, "disk");
+	EXPECT_EQ(config.catalogue[1].name, "cpu");
+	EXPECT_EQ(config.catalogue[1].price, 7);
+
+	const auto mapped = fromMappedFile(this->config("search"));
+	EXPECT_EQ(mapped["catalogue"][1]["name"].as<std::string>(), "cpu");
+	EXPECT_EQ(Document::fromFile(this->config("search")).root()["catalogue"].size(), 2);
+
+	// without the tag the scalar stays a file name
+	const auto plain = fromFile(write("plain.yaml", "catalogue: shared/catalogue.yaml\n"));
+	EXPECT_EQ(plain["catalogue"].as<std::string>(), "shared/catalogue.yaml");
+}
+
+TEST_F(IncludeTest, ParsedOnce) {
+	Includes                includes;
+	std::vector<YAML::Node> configs;
+	for (const auto* service : {"billing", "search", "auth"}) {
+		configs.push_back(includes.fromFile(config(service)));
+	}
+	EXPECT_EQ(includes.misses(), 2);
+	EXPECT_EQ(includes.hits(), 2);
+	EXPECT_EQ(includes.size(), 2);
+
+	// every document has its own copy
+	configs[0]["catalogue"][0]["price"] = 100;
+	EXPECT_EQ(configs[1]["catalogue"][0]["price"].as<int>(), 3);
+	EXPECT_EQ(includes.fromFile(config("admin"))["catalogue"][0]["price"].as<int>(), 3);
+
+	includes.clear();
+	includes.fromFile(config("admin"));
+	EXPECT_EQ(includes.misses(), 4);
+}
+
+TEST_F(IncludeTest, Changes) {
+	Includes   includes;
+	const auto billing = config("billing");
+	includes.fromFile(billing);
+	EXPECT_EQ(includes.misses(), 2);
+
+	// touched without changes, the content hash matches and the fragment it includes is reused with it
+	const auto catalogue = directory / "shared/catalogue.yaml";
+	std::filesystem::last_write_time(catalogue, std::filesystem::last_write_time(catalogue) + std::chrono::hours{1});
+	includes.fromFile(billing);
+	EXPECT_EQ(includes.misses(), 2);
+	EXPECT_EQ(includes.hits(), 1);
+
+	// a nested fragment changed, the catalogue including it is parsed again
+	write("shared/item.yaml", "{name: memory, price: 11}\n");
+	const ServiceConfig config{includes.fromFile(billing)};
+	EXPECT_EQ(config.catalogue[1].name, "memory");
+	EXPECT_EQ(includes.misses(), 4);
+}
+
+TEST_F(IncludeTest, Errors) {
+	Includes includes;
+	EXPECT_THROW(includes.fromFile(write("missing.yaml", "catalogue: !include nowhere.yaml\n")), YAML::BadFile);
+
+	write("shared/a.yaml", "next: !include b.yaml\n");
+	write("shared/b.yaml", "next: !include a.yaml\n");
+	try {
+		includes.fromFile(write("cycle.yaml", "start: !include shared/a.yaml\n"));
+		FAIL() << "Include cycle accepted";
+	} catch (const InvalidNode& e) {
+		EXPECT_EQ(e.yamlMark().line, 0);
+	}
+
+	// the cycle check is per thread and left clean after the error
+	EXPECT_EQ(includes.fromFile(config("billing"))["catalogue"].size(), 2);
+}
+
+TEST_F(IncludeTest, ManyFiles) {
+	std::vector<std::string> paths;
+	for (int i = 0; i < 32; ++i) {
+		paths.push_back(config("service" + std::to_string(i)));
+	}
+	const auto loaded = loadAll<ServiceConfig>(paths);
+	ASSERT_EQ(loaded.size(), paths.size());
+	for (std::size_t i = 0; i < loaded.size(); ++i) {
+		EXPECT_EQ(loaded[i].value().service, "service" + std::to_string(i));
+		EXPECT_EQ(loaded[i].value().catalogue[1].price, 7);
+	}
+}
@@ -0,0 +1,95 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Endpoint : Keyed<"host", "port", "weight", "tags"> {
+	using Keyed::Keyed;
+
+	std::string              host    = bound("host");
+	int                      port    = bound("port").addRuleRange(1, 65535);
+	double                   weight  = bound("weight", 1.0);
+	std::vector<std::string> tags    = bound("tags", std::vector<std::string>{});
+	bool                     enabled = bound("enabled", true); // not declared, looked up the regular way
+};
+
+struct Endpoints : Keyed<"name", "endpoints"> {
+	using Keyed::Keyed;
+
+	std::string           name      = bound("name");
+	std::vector<Endpoint> endpoints = bound("endpoints");
+};
+
+static const std::string source{R"(
+name: edge
+endpoints:
+  - {host: a.example.com, port: 80, weight: 0.5, tags: [x, y], enabled: false}
+  - {port: 443, host: b.example.com, unknown: 1}
+  - {host: c.example.com, port: 8080, host: ignored}
+)"};
+
+TEST(Keyed, SameAsLookup) {
+	const Endpoints config{fromString(source)};
+
+	EXPECT_EQ(config.name, "edge");
+	ASSERT_EQ(config.endpoints.size(), 3);
+	EXPECT_EQ(config.endpoints[0].host, "a.example.com");
+	EXPECT_EQ(config.endpoints[0].port, 80);
+	EXPECT_EQ(config.endpoints[0].weight, 0.5);
+	EXPECT_EQ(config.endpoints[0].tags, (std::vector<std::string>{"x", "y"}));
+	EXPECT_FALSE(config.endpoints[0].enabled);
+
+	EXPECT_EQ(config.endpoints[1].host, "b.example.com");
+	EXPECT_EQ(config.endpoints[1].port, 443);
+	EXPECT_EQ(config.endpoints[1].weight, 1.0);
+	EXPECT_TRUE(config.endpoints[1].tags.empty());
+	EXPECT_TRUE(config.endpoints[1].enabled);
+
+	// like a lookup, the first of duplicate keys wins
+	EXPECT_EQ(config.endpoints[2].host, "c.example.com");
+}
+
+TEST(Keyed, Errors) {
+	try {
+		const Endpoints config{fromString("{name: edge, endpoints: [{host: a, port: 0}]}")};
+		FAIL();
+	} catch (const ValidatorFailed& e) {
+		EXPECT_NE(std::string{e.what()}.find("/endpoints[0]/port"), std::string::npos) << e.what();
+	}
+	EXPECT_THROW(Endpoints{fromString("{name: edge, endpoints: [{port: 1}]}")}, MissingNode);
+	EXPECT_THROW(Endpoints{fromString("{name: edge, endpoints: [[1]]}")}, InvalidNodeType);
+}
+
+TEST(Keyed, OtherBindings) {
+	const auto streamed = bindString<Endpoints>(source);
+	ASSERT_EQ(streamed.endpoints.size(), 3);
+	EXPECT_EQ(streamed.endpoints[1].port, 443);
+
+	const auto detached = bindDetached<Endpoints>(fromString(source));
+	EXPECT_EQ(detached.endpoints[0].tags.size(), 2);
+	EXPECT_EQ(detached.retained().nodes, 0);
+
+	Reloader<Endpoints> reloader;
+	reloader.bind(fromString(source));
+	const auto reloaded = reloader.bind(fromString(source));
+	EXPECT_EQ(reloaded.endpoints[2].port, 8080);
+	EXPECT_GT(reloader.stats().reused(), 0);
+}
+
+TEST(Keyed, PerfectHash) {
+	constexpr detail::PerfectHash<3> table{{"host", "port", "weight"}};
+	static_assert(table.find("port") == 1);
+	static_assert(table.find("weight") == 2);
+	static_assert(table.find("Port") == table.npos);
+	static_assert(table.find("") == table.npos);
+
+	// names differing only in the high bits of their characters
+	constexpr detail::PerfectHash<2> protocols{{"Tcp", "Udp"}};
+	static_assert(protocols.find("Tcp") == 0);
+	static_assert(protocols.find("Udp") == 1);
+
+	constexpr detail::PerfectHash<0> empty{{}};
+	static_assert(empty.find("host") == empty.npos);
+}
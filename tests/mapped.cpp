@@ -0,0 +1,51 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+static const std::string source{R"(
+name: mapped
+ports: [80, 443]
+)"};
+
+struct MappedConfig : Simple {
+	using Simple::Simple;
+
+	std::string      name  = bound("name");
+	std::vector<int> ports = bound("ports");
+};
+
+static std::filesystem::path writeTemporary(const std::string& name, const std::string& content) {
+	const auto path = std::filesystem::temp_directory_path() / name;
+	std::ofstream{path, std::ios::binary} << content;
+	return path;
+}
+
+TEST(MappedFile, SameAsFromFile) {
+	const auto path = writeTemporary("simple_yaml_mapped.yaml", source);
+
+	const MappedConfig mapped{fromMappedFile(path.string())};
+	const MappedConfig streamed{fromFile(path.string())};
+	EXPECT_EQ(mapped.name, streamed.name);
+	EXPECT_EQ(mapped.ports, streamed.ports);
+
+	const auto bound = bindMappedFile<MappedConfig>(path.string());
+	EXPECT_EQ(bound.name, "mapped");
+
+	auto document = Document::fromMappedFile(path.string());
+	EXPECT_EQ(document.root()["name"].Scalar(), "mapped");
+
+	std::filesystem::remove(path);
+}
+
+TEST(MappedFile, EmptyAndMissing) {
+	const auto path = writeTemporary("simple_yaml_mapped_empty.yaml", "");
+	EXPECT_TRUE(fromMappedFile(path.string()).IsNull());
+	std::filesystem::remove(path);
+
+	EXPECT_THROW(fromMappedFile("/nonexistent/simple_yaml.yaml"), YAML::BadFile);
+}
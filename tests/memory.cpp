@@ -0,0 +1,126 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <optional>
+#include <string>
+
+using namespace simple_yaml;
+
+struct Bucket : Simple {
+	using Simple::Simple;
+
+	std::pmr::string                   name = bound("name");
+	std::pmr::vector<std::pmr::string> keys = bound("keys", std::pmr::vector<std::pmr::string>{});
+};
+
+struct Catalog : Simple {
+	using Simple::Simple;
+
+	std::pmr::string                                       owner   = bound("owner", std::pmr::string{"nobody"});
+	std::pmr::vector<Bucket>                               buckets = bound("buckets");
+	std::pmr::map<std::pmr::string, std::pmr::vector<int>> limits  = bound("limits");
+	int                                                    version = bound("version");
+};
+
+static const std::string source = R"(
+buckets:
+  - {name: a bucket name long enough to be allocated, keys: [first key long enough to be allocated, second]}
+  - {name: b}
+limits: {reads per second and per client: [10, 20], writes: [5]}
+version: 3
+)";
+
+// Counts the allocations it forwards upstream
+class CountingResource : public std::pmr::memory_resource {
+public:
+	std::size_t allocations{0};
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+};
+
+// Allocations from the default resource fail while it is alive
+class NoDefaultResource {
+public:
+	NoDefaultResource() : _previous(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {
+	}
+
+	~NoDefaultResource() {
+		std::pmr::set_default_resource(_previous);
+	}
+
+private:
+	std::pmr::memory_resource* _previous;
+};
+
+static void expectAllocatedFrom(const Catalog& catalog, std::pmr::memory_resource* resource) {
+	EXPECT_EQ(catalog.owner.get_allocator().resource(), resource);
+	EXPECT_EQ(catalog.buckets.get_allocator().resource(), resource);
+	EXPECT_EQ(catalog.limits.get_allocator().resource(), resource);
+	for (const auto& bucket : catalog.buckets) {
+		EXPECT_EQ(bucket.name.get_allocator().resource(), resource);
+		EXPECT_EQ(bucket.keys.get_allocator().resource(), resource);
+		for (const auto& key : bucket.keys) {
+			EXPECT_EQ(key.get_allocator().resource(), resource);
+		}
+	}
+	for (const auto& [name, values] : catalog.limits) {
+		EXPECT_EQ(name.get_allocator().resource(), resource);
+		EXPECT_EQ(values.get_allocator().resource(), resource);
+	}
+}
+
+TEST(Memory, BindAllocated) {
+	const auto                          root = fromString(source);
+	CountingResource                    upstream;
+	std::pmr::monotonic_buffer_resource arena{&upstream};
+	std::optional<Catalog>              catalog;
+	{
+		const NoDefaultResource noDefault;
+		catalog.emplace(bindAllocated<Catalog>(root, arena));
+	}
+	ASSERT_EQ(catalog->buckets.size(), 2);
+	EXPECT_EQ(catalog->buckets[0].keys[0], "first key long enough to be allocated");
+	EXPECT_TRUE(catalog->buckets[1].keys.empty());
+	EXPECT_EQ(catalog->owner, "nobody");
+	EXPECT_EQ(catalog->limits.at("reads per second and per client"), (std::pmr::vector<int>{10, 20}));
+	EXPECT_EQ(catalog->version, 3);
+	expectAllocatedFrom(*catalog, &arena);
+	EXPECT_GT(upstream.allocations, 0);
+	EXPECT_LT(upstream.allocations, 5);
+}
+
+TEST(Memory, DefaultResource) {
+	const Catalog catalog{fromString(source)};
+	expectAllocatedFrom(catalog, std::pmr::get_default_resource());
+	EXPECT_EQ(toString(catalog.limits), "reads per second and per client:\n  - 10\n  - 20\nwrites:\n  - 5\n");
+}
+
+TEST(Memory, OtherBindings) {
+	std::pmr::monotonic_buffer_resource arena;
+	const Memory::Scope                 scope{arena};
+	const NoDefaultResource             noDefault;
+
+	expectAllocatedFrom(bindString<Catalog>(source), &arena);
+
+	ThreadPool            pool{2};
+	const Parallel::Scope parallel{pool, 1};
+	expectAllocatedFrom(Catalog{fromString(source)}, &arena);
+
+	const auto keys = tryDeserialize<std::pmr::vector<std::pmr::string>>(fromString("[a string long enough to be allocated, b]"));
+	ASSERT_TRUE(keys.has_value());
+	EXPECT_EQ(keys->get_allocator().resource(), &arena);
+	EXPECT_EQ(keys->front().get_allocator().resource(), &arena);
+}
@@ -0,0 +1,80 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Tenant : Simple {
+	using Simple::Simple;
+
+	std::string      name  = bound("name").addRuleRegex("^tenant-[0-9]+$");
+	int              quota = bound("quota").addRuleMinimum(0);
+	std::vector<int> ports = bound("ports");
+};
+
+struct Tenants : Simple {
+	using Simple::Simple;
+
+	std::vector<Tenant>                tenants = bound("tenants");
+	std::map<std::string, int>         quotas  = bound("quotas");
+	std::unordered_multimap<int, bool> flags   = bound("flags");
+};
+
+static std::string generate(std::size_t count, const std::vector<std::size_t>& invalid = {}) {
+	std::string source = "tenants:\n";
+	for (std::size_t i = 0; i < count; ++i) {
+		const bool bad = std::find(invalid.begin(), invalid.end(), i) != invalid.end();
+		source += "  - {name: tenant-" + std::to_string(i) + ", quota: " + (bad ? "-1" : std::to_string(i)) + ", ports: [1, 2]}\n";
+	}
+	source += "quotas:\n";
+	for (std::size_t i = 0; i < count; ++i) {
+		source += "  q" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+	}
+	source += "flags: {1: true, 2: false}\n";
+	return source;
+}
+
+TEST(Parallel, SameAsSerial) {
+	const auto    source = generate(3000);
+	const Tenants serial{fromString(source)};
+
+	ThreadPool      pool{4};
+	Parallel::Scope scope{pool, 16};
+	const Tenants   parallel{fromString(source)};
+
+	ASSERT_EQ(parallel.tenants.size(), serial.tenants.size());
+	for (std::size_t i = 0; i < serial.tenants.size(); ++i) {
+		EXPECT_EQ(parallel.tenants[i].name, serial.tenants[i].name);
+		EXPECT_EQ(parallel.tenants[i].quota, serial.tenants[i].quota);
+		EXPECT_EQ(parallel.tenants[i].ports, serial.tenants[i].ports);
+	}
+	EXPECT_EQ(parallel.quotas, serial.quotas);
+	EXPECT_EQ(parallel.flags.size(), 2);
+}
+
+TEST(Parallel, LowestIndexError) {
+	const auto source = generate(3000, {2700, 1234, 2999});
+
+	ThreadPool      pool{8};
+	Parallel::Scope scope{pool, 16};
+	for (int run = 0; run < 5; ++run) {
+		try {
+			const Tenants tenants{fromString(source)};
+			FAIL() << "Expected ValidatorFailed";
+		} catch (const ValidatorFailed& e) {
+			EXPECT_EQ(std::string{e.what()}, "Validation failed for /tenants[1234]/quota");
+		}
+	}
+}
+
+TEST(Parallel, BelowThresholdAndWithDocument) {
+	ThreadPool      pool{2};
+	Parallel::Scope scope{pool, 1 << 20};
+	EXPECT_EQ(Parallel::worth(100), nullptr);
+
+	auto document = Document::fromString("[a, b, c]");
+	EXPECT_EQ(document.bind<std::vector<std::string_view>>(), (std::vector<std::string_view>{"a", "b", "c"}));
+}
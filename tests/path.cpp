@@ -0,0 +1,89 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+using namespace simple_yaml;
+
+static const std::string source{R"(
+servers:
+  - url: first
+    ports: [1, 2]
+  - ports: [3, 4]
+users:
+  admin:
+    name: root
+)"};
+
+struct Server : Simple {
+	using Simple::Simple;
+
+	std::string      url   = bound("url");
+	std::vector<int> ports = bound("ports");
+};
+
+struct User : Simple {
+	using Simple::Simple;
+
+	std::string name  = bound("name");
+	int         level = bound("level");
+};
+
+TEST(Path, Segments) {
+	const Path root{"root"};
+	const Path servers{root, "servers"};
+	const Path second{servers, std::size_t{1}};
+	const Path port{second, "port"};
+
+	EXPECT_EQ(root.str(), "root");
+	EXPECT_EQ(port.str(), "root/servers[1]/port");
+	EXPECT_EQ("at " + port, "at root/servers[1]/port");
+	EXPECT_EQ(std::string{"at "} + port, "at root/servers[1]/port");
+}
+
+TEST(Path, SequenceErrorMessage) {
+	auto missing = [] {
+		struct : Simple {
+			std::vector<Server> servers = bound("servers");
+		} config{fromString(source)};
+	};
+
+	try {
+		missing();
+		FAIL();
+	} catch (const MissingNode& e) {
+		EXPECT_STREQ(e.what(), "Missing node /servers[1]/url");
+	}
+}
+
+TEST(Path, MapErrorMessage) {
+	auto missing = [] {
+		struct : Simple {
+			std::map<std::string, User> users = bound("users");
+		} config{fromString(source)};
+	};
+
+	try {
+		missing();
+		FAIL();
+	} catch (const MissingNode& e) {
+		EXPECT_STREQ(e.what(), "Missing node /users/admin/level");
+	}
+}
+
+TEST(Path, RootPrefix) {
+	auto missing = [] {
+		struct Config : Simple {
+			using Simple::Simple;
+
+			std::array<std::string, 1> urls = bound("urls");
+		} config{fromString(source), std::string{"config.yaml"}};
+	};
+
+	try {
+		missing();
+		FAIL();
+	} catch (const MissingNode& e) {
+		EXPECT_STREQ(e.what(), "Missing node config.yaml/urls");
+	}
+}
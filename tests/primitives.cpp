@@ -1,5 +1,8 @@
 #include "simple-yaml/simple_yaml.hpp"
+#include <cmath>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <limits>
 #include <string>
 
 using namespace simple_yaml;
@@ -331,3 +334,63 @@ TEST(Primitives, InvalidToLong) {
 	EXPECT_THROW(invalidFromDouble(), YAML::TypedBadConversion<long>);
 	EXPECT_THROW(invalidFromChar(), YAML::TypedBadConversion<long>);
 }
+
+template<typename T>
+static T convert(const std::string& scalar) {
+	return Deserializer<T>::deserialize(YAML::Load(scalar), "/value");
+}
+
+TEST(Primitives, CoreSchema) {
+	EXPECT_EQ(convert<int>("0x1F"), 31);
+	EXPECT_EQ(convert<int>("0o17"), 15);
+	EXPECT_EQ(convert<int>("+12"), 12);
+	EXPECT_EQ(convert<int>("-12"), -12);
+	EXPECT_EQ(convert<int>("007"), 7);
+	EXPECT_EQ(convert<uint64_t>("0xFFFFFFFFFFFFFFFF"), std::numeric_limits<uint64_t>::max());
+	EXPECT_EQ(convert<int64_t>("-9223372036854775808"), std::numeric_limits<int64_t>::min());
+	EXPECT_EQ(convert<unsigned>("-0"), 0u);
+	EXPECT_THROW(convert<int>("-0x1F"), InvalidValue<int>);
+	EXPECT_THROW(convert<int>("0o8"), InvalidValue<int>);
+	EXPECT_THROW(convert<int>("1e3"), InvalidValue<int>);
+	EXPECT_THROW(convert<int>("+-1"), InvalidValue<int>);
+	EXPECT_THROW(convert<int>("''"), InvalidValue<int>);
+
+	EXPECT_EQ(convert<double>("1e3"), 1000.0);
+	EXPECT_EQ(convert<double>("+.5"), 0.5);
+	EXPECT_EQ(convert<double>("2."), 2.0);
+	EXPECT_EQ(convert<double>("0x10"), 16.0);
+	EXPECT_EQ(convert<double>(".inf"), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(convert<float>("-.INF"), -std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(convert<double>(".NaN")));
+	EXPECT_THROW(convert<double>("inf"), InvalidValue<double>);
+	EXPECT_THROW(convert<double>("nan"), InvalidValue<double>);
+	EXPECT_THROW(convert<double>("-.nan"), InvalidValue<double>);
+	EXPECT_THROW(convert<double>(".Nan"), InvalidValue<double>);
+	EXPECT_THROW(convert<double>("1.5x"), InvalidValue<double>);
+
+	EXPECT_TRUE(convert<bool>("true"));
+	EXPECT_TRUE(convert<bool>("True"));
+	EXPECT_TRUE(convert<bool>("YES"));
+	EXPECT_FALSE(convert<bool>("FALSE"));
+	EXPECT_FALSE(convert<bool>("off"));
+	EXPECT_THROW(convert<bool>("tRUE"), InvalidValue<bool>);
+	EXPECT_THROW(convert<bool>("1"), InvalidValue<bool>);
+}
+
+TEST(Primitives, OutOfRange) {
+	EXPECT_THROW(convert<int>("2147483648"), OutOfRange<int>);
+	EXPECT_EQ(convert<int>("-2147483648"), std::numeric_limits<int>::min());
+	EXPECT_THROW(convert<int>("-2147483649"), OutOfRange<int>);
+	EXPECT_THROW(convert<uint16_t>("0x10000"), OutOfRange<uint16_t>);
+	EXPECT_THROW(convert<unsigned>("-1"), OutOfRange<unsigned>);
+	EXPECT_THROW(convert<uint64_t>("18446744073709551616"), OutOfRange<uint64_t>);
+	EXPECT_THROW(convert<float>("1e39"), OutOfRange<float>);
+	EXPECT_THROW(convert<double>("-1e400"), OutOfRange<double>);
+
+	try {
+		convert<short>("40000");
+		FAIL();
+	} catch (const YAML::TypedBadConversion<short>& e) {
+		EXPECT_EQ(std::string{e.what()}, "Value \"40000\" out of range [-32768, 32767] at /value");
+	}
+}
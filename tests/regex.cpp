@@ -0,0 +1,125 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+namespace {
+
+template<FixedString Pattern>
+void expectSameAsStd(const std::vector<std::string>& inputs) {
+	const std::regex regex{std::string{Pattern.view()}};
+	for (const auto& input : inputs) {
+		EXPECT_EQ(StaticRegex<Pattern>::match(input), std::regex_match(input, regex)) << Pattern.view() << " on \"" << input << "\"";
+	}
+}
+
+const std::vector<std::string> inputs{
+    "",
+    "a",
+    "abc",
+    "ABC",
+    "123",
+    "12a",
+    "host.example.com",
+    "-host.example.com",
+    "a_b",
+    "a b",
+    "aaaa",
+    "abab",
+    "ab\n",
+    "1.2.3.4",
+    "256.1.1.1",
+    "x]y",
+    "a-z",
+};
+
+} // namespace
+
+TEST(Regex, StaticMatchesStd) {
+	expectSameAsStd<"">(inputs);
+	expectSameAsStd<"abc">(inputs);
+	expectSameAsStd<"^\\d+$">(inputs);
+	expectSameAsStd<"[a-z]*">(inputs);
+	expectSameAsStd<"[^a-z]+">(inputs);
+	expectSameAsStd<"[A-Za-z0-9_]+">(inputs);
+	expectSameAsStd<"\\w+">(inputs);
+	expectSameAsStd<"\\w\\s\\w">(inputs);
+	expectSameAsStd<"\\D*">(inputs);
+	expectSameAsStd<"a.c">(inputs);
+	expectSameAsStd<"ab.">(inputs);
+	expectSameAsStd<"(ab)+">(inputs);
+	expectSameAsStd<"(?:ab)*">(inputs);
+	expectSameAsStd<"a|abc|123">(inputs);
+	expectSameAsStd<"(a|b)*c?">(inputs);
+	expectSameAsStd<"a{2,3}">(inputs);
+	expectSameAsStd<"a{4}">(inputs);
+	expectSameAsStd<"a{1,}">(inputs);
+	expectSameAsStd<"(ab){1,2}">(inputs);
+	expectSameAsStd<"a+?">(inputs);
+	expectSameAsStd<"[\\d.]+">(inputs);
+	expectSameAsStd<"[x\\]y]+">(inputs);
+	expectSameAsStd<"[a\\-z]+">(inputs);
+	expectSameAsStd<"[-a]+">(inputs);
+	expectSameAsStd<"^([0-9]{1,3}\\.){3}[0-9]{1,3}$">(inputs);
+	expectSameAsStd<"^([a-z0-9]([a-z0-9-]{0,61}[a-z0-9])?\\.)*[a-z0-9]([a-z0-9-]{0,61}[a-z0-9])?$">(inputs);
+}
+
+TEST(Regex, CacheCompilesOnce) {
+	RegexCache::clear();
+
+	const auto first  = RegexCache::get("^[a-z]+$");
+	const auto second = RegexCache::get("^[a-z]+$");
+	const auto icase  = RegexCache::get("^[a-z]+$", std::regex::ECMAScript | std::regex::icase);
+
+	EXPECT_EQ(first, second);
+	EXPECT_NE(first, icase);
+	EXPECT_EQ(RegexCache::size(), 2);
+	EXPECT_TRUE(std::regex_match("ABC", *icase));
+	EXPECT_FALSE(std::regex_match("ABC", *first));
+}
+
+static const std::string source{R"(
+hosts:
+  - name: alpha.example.com
+  - name: beta.example.com
+  - name: gamma.example.com
+invalid: -invalid
+)"};
+
+struct Host : Simple {
+	using Simple::Simple;
+
+	std::string name    = bound("name").addRuleRegex("^[a-z.]+$");
+	std::string literal = bound("name").addRuleRegex<"^[a-z.]+$">();
+};
+
+TEST(Regex, FieldRules) {
+	RegexCache::clear();
+
+	const struct : Simple {
+		using Simple::Simple;
+
+		std::vector<Host> hosts = bound("hosts");
+	} config{fromString(source)};
+
+	EXPECT_EQ(config.hosts.size(), 3);
+	EXPECT_EQ(config.hosts[2].literal, "gamma.example.com");
+	EXPECT_EQ(RegexCache::size(), 1);
+
+	auto invalid = [] {
+		struct : Simple {
+			std::string invalid = bound("invalid").addRuleRegex("^[a-z.]+$");
+		} config{fromString(source)};
+	};
+
+	auto invalidStatic = [] {
+		struct : Simple {
+			std::string invalid = bound("invalid").addRuleRegex<"^[a-z.]+$">();
+		} config{fromString(source)};
+	};
+
+	EXPECT_THROW(invalid(), ValidatorFailed);
+	EXPECT_THROW(invalidStatic(), ValidatorFailed);
+}
@@ -0,0 +1,95 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+namespace {
+
+struct Checked {
+	static inline int conversions{0};
+
+	std::string value;
+};
+
+} // namespace
+
+template<>
+struct simple_yaml::Deserializer<Checked> {
+	static Checked deserialize(const YAML::Node& n, const Path&) {
+		++Checked::conversions;
+		return Checked{n.as<std::string>()};
+	}
+};
+
+struct Service : Simple {
+	using Simple::Simple;
+
+	Checked host = bound("host");
+	int     port = bound("port").addRuleRange(1, 65535);
+};
+
+struct Services : Simple {
+	using Simple::Simple;
+
+	std::string          name     = bound("name");
+	std::vector<Service> services = bound("services");
+	Checked              owner    = bound("owner");
+};
+
+static std::string generate(const std::string& changedHost, std::size_t count = 100) {
+	std::string source = "name: mesh\nowner: ops\nservices:\n";
+	for (std::size_t i = 0; i < count; ++i) {
+		source += "  - {host: " + (i == 42 ? changedHost : "host" + std::to_string(i)) + ", port: " + std::to_string(1000 + i) + "}\n";
+	}
+	return source;
+}
+
+TEST(Reload, OnlyChangedSubtrees) {
+	Reloader<Services> reloader;
+
+	Checked::conversions = 0;
+	auto first           = reloader.bind(fromString(generate("host42")));
+	EXPECT_EQ(Checked::conversions, 101);
+	EXPECT_EQ(reloader.stats().reused(), 0);
+
+	Checked::conversions = 0;
+	auto second          = reloader.bind(fromString(generate("changed")));
+	EXPECT_EQ(Checked::conversions, 1);
+	EXPECT_EQ(second.services[42].host.value, "changed");
+	EXPECT_EQ(second.services[41].host.value, "host41");
+	EXPECT_EQ(second.services[99].port, 1099);
+	EXPECT_EQ(second.owner.value, "ops");
+
+	// Nothing changed, the whole sequence is reused, its fields stay cached for the next change
+	Checked::conversions = 0;
+	auto third           = reloader.bind(fromString(generate("changed")));
+	EXPECT_EQ(Checked::conversions, 0);
+	EXPECT_EQ(third.services.size(), 100);
+
+	Checked::conversions = 0;
+	auto fourth          = reloader.bind(fromString(generate("again")));
+	EXPECT_EQ(Checked::conversions, 1);
+	EXPECT_EQ(fourth.services[42].host.value, "again");
+}
+
+TEST(Reload, ErrorsAndRemovedEntries) {
+	Reloader<Services> reloader;
+	reloader.bind(fromString(generate("host42")));
+
+	auto invalid = generate("host42");
+	invalid.replace(invalid.find("port: 1042"), 10, "port: 0");
+	EXPECT_THROW(reloader.bind(fromString(invalid)), ValidatorFailed);
+
+	const auto smaller = reloader.bind(fromString(generate("host42", 10)));
+	EXPECT_EQ(smaller.services.size(), 10);
+	EXPECT_LT(reloader.stats().size(), 30);
+}
+
+TEST(Reload, FingerprintIsContentBased) {
+	EXPECT_EQ(fingerprint(fromString("{a: [1, 2], b: x}")), fingerprint(fromString("a:\n  - 1\n  - 2\nb: x\n")));
+	EXPECT_NE(fingerprint(fromString("{a: [1, 2]}")), fingerprint(fromString("{a: [12]}")));
+	EXPECT_NE(fingerprint(fromString("{a: 1, b: 2}")), fingerprint(fromString("{b: 2, a: 1}")));
+	EXPECT_NE(fingerprint(fromString("a: '1'")), fingerprint(fromString("a: 1")));
+}
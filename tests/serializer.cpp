@@ -0,0 +1,153 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+enum class ProxyMode { Fast, Safe };
+
+struct ProxyLimits : Simple {
+	using Simple::Simple;
+
+	int                       connections = bound("connections");
+	std::chrono::milliseconds timeout     = bound("timeout");
+
+	void serialize(Emitter& out) const {
+		out.entry("connections", connections).entry("timeout", timeout);
+	}
+};
+
+struct Proxy : Simple {
+	using Simple::Simple;
+
+	std::string                   name     = bound("name");
+	ProxyMode                     mode     = bound("mode");
+	double                        ratio    = bound("ratio");
+	std::vector<std::string>      hosts    = bound("hosts");
+	std::vector<ProxyLimits>      limits   = bound("limits");
+	std::map<std::string, int>    weights  = bound("weights");
+	std::vector<std::vector<int>> matrix   = bound("matrix");
+	std::vector<int>              disabled = bound("disabled");
+
+	void serialize(Emitter& out) const {
+		out.entry("name", name).entry("mode", mode).entry("ratio", ratio).entry("hosts", hosts).entry("limits", limits);
+		out.entry("weights", weights).entry("matrix", matrix).entry("disabled", disabled);
+	}
+};
+
+template<typename T>
+static T roundTrip(const T& value) {
+	return Deserializer<T>::deserialize(fromString(toString(value)), Path{});
+}
+
+TEST(Serializer, Numbers) {
+	EXPECT_EQ(toString(42), "42\n");
+	EXPECT_EQ(toString(true), "true\n");
+	EXPECT_EQ(toString(0.1), "0.1\n");
+	EXPECT_EQ(toString(-std::numeric_limits<double>::infinity()), "-.inf\n");
+
+	for (const double value : {0.1, 1.0 / 3.0, 1e300, -2.5e-308, 5e-324, std::numeric_limits<double>::max()}) {
+		EXPECT_EQ(roundTrip(value), value) << toString(value);
+	}
+	EXPECT_EQ(roundTrip(0.1f), 0.1f);
+	EXPECT_TRUE(std::isnan(roundTrip(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(roundTrip(std::numeric_limits<std::int64_t>::min()), std::numeric_limits<std::int64_t>::min());
+	EXPECT_EQ(roundTrip(std::numeric_limits<std::uint64_t>::max()), std::numeric_limits<std::uint64_t>::max());
+	EXPECT_EQ(roundTrip('x'), 'x');
+	EXPECT_EQ(roundTrip('#'), '#');
+}
+
+TEST(Serializer, Strings) {
+	for (const std::string value : {"plain text", "", " padded ", "true", "no", "0x1F", "1e5", ".inf", "null", "~", "- item", "key: value",
+	                                "comment #here", "#start", "line\nbreak", "tab\tquote\"back\\slash", "trailing:", "\x01", "ünïcödé"}) {
+		EXPECT_EQ(roundTrip(value), value) << toString(value);
+	}
+	EXPECT_EQ(toString(std::string{"plain text"}), "plain text\n");
+	EXPECT_EQ(toString(std::string{"yes"}), "\"yes\"\n");
+}
+
+TEST(Serializer, Durations) {
+	using namespace std::chrono;
+
+	EXPECT_EQ(toString(minutes{90}), "1h 30m\n");
+	EXPECT_EQ(toString(milliseconds{-90'500}), "-1m -30s -500ms\n");
+	EXPECT_EQ(toString(seconds{0}), "0\n");
+	EXPECT_EQ(toString(duration<double>{1.5}), "1.5\n");
+
+	EXPECT_EQ(roundTrip(days{3} + hours{4} + nanoseconds{5}), days{3} + hours{4} + nanoseconds{5});
+	EXPECT_EQ(roundTrip(minutes{-90}), minutes{-90});
+	EXPECT_EQ(roundTrip(duration<std::int64_t, std::ratio<1, 3>>{10}), (duration<std::int64_t, std::ratio<1, 3>>{10}));
+}
+
+TEST(Serializer, Structures) {
+	const std::string source{R"(
+name: "api: v2"
+mode: Safe
+ratio: 0.3
+hosts: [a.example.com, "true"]
+limits:
+  - {connections: 10, timeout: 1500ms}
+  - {connections: 20, timeout: 2s}
+weights: {a: 1, b: 2}
+matrix: [[1, 2], [], [3]]
+disabled: []
+)"};
+	const Proxy proxy{fromString(source)};
+
+	const auto text = toString(proxy);
+	EXPECT_EQ(text, R"(name: "api: v2"
+mode: Safe
+ratio: 0.3
+hosts:
+  - a.example.com
+  - "true"
+limits:
+  - connections: 10
+    timeout: 1s 500ms
+  - connections: 20
+    timeout: 2s
+weights:
+  a: 1
+  b: 2
+matrix:
+  - - 1
+    - 2
+  - []
+  - - 3
+disabled: []
+)");
+
+	const Proxy copy{fromString(text)};
+	EXPECT_EQ(copy.name, proxy.name);
+	EXPECT_EQ(copy.mode, ProxyMode::Safe);
+	EXPECT_EQ(copy.ratio, proxy.ratio);
+	EXPECT_EQ(copy.hosts, proxy.hosts);
+	ASSERT_EQ(copy.limits.size(), 2);
+	EXPECT_EQ(copy.limits[0].timeout, proxy.limits[0].timeout);
+	EXPECT_EQ(copy.weights, proxy.weights);
+	EXPECT_EQ(copy.matrix, proxy.matrix);
+	EXPECT_TRUE(copy.disabled.empty());
+}
+
+TEST(Serializer, ReusedBuffer) {
+	std::string buffer;
+	toString(std::vector<int>{1, 2, 3}, buffer);
+	EXPECT_EQ(buffer, "- 1\n- 2\n- 3\n");
+	const auto capacity = buffer.capacity();
+	toString(std::map<int, bool>{{1, true}}, buffer);
+	EXPECT_EQ(buffer, "1: true\n");
+	EXPECT_EQ(buffer.capacity(), capacity);
+	toString(std::vector<int>{}, buffer);
+	EXPECT_EQ(buffer, "[]\n");
+
+	Emitter out{buffer};
+	EXPECT_THROW(out.key(), std::logic_error);
+	out.beginMap();
+	EXPECT_THROW(out.key().beginMap(), std::logic_error);
+}
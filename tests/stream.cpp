@@ -0,0 +1,98 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace simple_yaml;
+using namespace std::chrono_literals;
+
+static const std::string source{R"(
+name: gateway
+timeout: 1m 30s
+ratio: 0.75
+enabled: true
+unknown: {nested: [1, 2, {deep: 3}]}
+defaults: &defaults
+  host: localhost
+  port: 8080
+servers:
+  - *defaults
+  - host: example.com
+    port: 443
+    tags: [edge, tls]
+limits:
+  cpu: 2
+  memory: 512
+ports: [80, 443]
+)"};
+
+struct Upstream : Simple {
+	using Simple::Simple;
+
+	std::string              host = bound("host");
+	int                      port = bound("port").addRuleRange(1, 65535);
+	std::vector<std::string> tags = bound("tags", std::vector<std::string>{});
+};
+
+struct Gateway : Simple {
+	using Simple::Simple;
+
+	std::string                          name     = bound("name");
+	std::chrono::seconds                 timeout  = bound("timeout");
+	double                               ratio    = bound("ratio");
+	bool                                 enabled  = bound("enabled");
+	int                                  retries  = bound("retries", 3);
+	Upstream                             defaults = bound("defaults");
+	std::vector<Upstream>                servers  = bound("servers");
+	std::map<std::string, int>           limits   = bound("limits");
+	std::unordered_map<std::string, int> others   = bound("limits");
+	std::vector<std::string>             ports    = bound("ports").addRule<std::vector<int>>([](const auto& p) { return p.size() == 2; });
+};
+
+TEST(Stream, SameAsTree) {
+	const auto streamed = bindString<Gateway>(source);
+	const Gateway tree{fromString(source)};
+
+	EXPECT_EQ(streamed.name, "gateway");
+	EXPECT_EQ(streamed.timeout, 90s);
+	EXPECT_DOUBLE_EQ(streamed.ratio, 0.75);
+	EXPECT_TRUE(streamed.enabled);
+	EXPECT_EQ(streamed.retries, 3);
+	EXPECT_EQ(streamed.defaults.host, "localhost");
+	ASSERT_EQ(streamed.servers.size(), 2);
+	EXPECT_EQ(streamed.servers[0].host, "localhost");
+	EXPECT_EQ(streamed.servers[0].port, 8080);
+	EXPECT_EQ(streamed.servers[1].tags, (std::vector<std::string>{"edge", "tls"}));
+	EXPECT_EQ(streamed.limits, tree.limits);
+	EXPECT_EQ(streamed.others, tree.others);
+	EXPECT_EQ(streamed.ports, (std::vector<std::string>{"80", "443"}));
+
+	for (std::size_t i = 0; i < tree.servers.size(); ++i) {
+		EXPECT_EQ(streamed.servers[i].host, tree.servers[i].host);
+		EXPECT_EQ(streamed.servers[i].port, tree.servers[i].port);
+		EXPECT_EQ(streamed.servers[i].tags, tree.servers[i].tags);
+	}
+}
+
+TEST(Stream, Errors) {
+	try {
+		bindString<Gateway>("name: gateway\ntimeout: 1s\nratio: 1\nenabled: true\ndefaults: {host: a, port: 1}\nservers: [{port: 1}]\n");
+		FAIL() << "Expected MissingNode";
+	} catch (const MissingNode& e) {
+		EXPECT_EQ(std::string{e.what()}, "Missing node /servers[0]/host");
+	}
+
+	EXPECT_THROW(bindString<Upstream>("host: a\nport: 70000\n"), ValidatorFailed);
+	EXPECT_THROW(bindString<Upstream>("[host, port]"), InvalidNodeType);
+	EXPECT_THROW(bindString<Upstream>("host: [a]\nport: 1\n"), InvalidNodeType);
+	EXPECT_THROW(bindString<Upstream>(""), MissingNode);
+}
+
+TEST(Stream, Containers) {
+	EXPECT_EQ(bindString<std::vector<int>>("[1, 2, 3]"), (std::vector<int>{1, 2, 3}));
+	EXPECT_EQ((bindString<std::map<std::string, std::vector<int>>>("a: [1]\nb: []\n")), (std::map<std::string, std::vector<int>>{{"a", {1}}, {"b", {}}}));
+	EXPECT_EQ(bindString<std::string>("text"), "text");
+}
@@ -0,0 +1,130 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct DumpRecord : Simple {
+	using Simple::Simple;
+
+	std::string              name = bound("name");
+	int                      size = bound("size").addRuleMinimum(0);
+	std::vector<std::string> tags = bound("tags", std::vector<std::string>{});
+};
+
+// Produces `count` records of a top-level sequence as they are read, remembers how much was read
+class RecordSource : public std::streambuf {
+public:
+	explicit RecordSource(std::size_t count) : _count(count) {
+	}
+
+	std::size_t produced() const {
+		return _produced;
+	}
+
+private:
+	int_type underflow() override {
+		if (_next == _count) {
+			return traits_type::eof();
+		}
+		_buffer = "- {name: record-" + std::to_string(_next) + ", size: " + std::to_string(_next) + ", tags: [a, b]}\n";
+		++_next;
+		_produced += _buffer.size();
+		setg(_buffer.data(), _buffer.data(), _buffer.data() + _buffer.size());
+		return traits_type::to_int_type(_buffer.front());
+	}
+
+	std::size_t _count;
+	std::size_t _next{0};
+	std::size_t _produced{0};
+	std::string _buffer;
+};
+
+TEST(Streaming, Sequence) {
+	std::istringstream       is{"- {name: a, size: 1}\n- &b {name: b, size: 2, tags: [x]}\n- *b\n"};
+	std::vector<std::string> names;
+	const auto               count = streamSequence<DumpRecord>(is, [&](DumpRecord&& record) { names.push_back(record.name); });
+	EXPECT_EQ(count, 3);
+	EXPECT_EQ(names, (std::vector<std::string>{"a", "b", "b"}));
+
+	int  sum{0};
+	auto add = [&](int value) { sum += value; };
+
+	std::istringstream numbers{"[1, 2, 3]"};
+	EXPECT_EQ(streamSequence<int>(numbers, add), 3);
+	EXPECT_EQ(sum, 6);
+
+	std::istringstream null{"~"};
+	EXPECT_EQ(streamSequence<int>(null, add), 0);
+}
+
+TEST(Streaming, ElementsBeforeTheEnd) {
+	constexpr std::size_t records = 20000;
+	RecordSource          source{records};
+	std::istream          is{&source};
+
+	std::size_t producedAtFirst{0};
+	std::size_t next{0};
+	const auto  count = streamSequence<DumpRecord>(is, [&](DumpRecord&& record) {
+		if (next == 0) {
+			producedAtFirst = source.produced();
+		}
+		EXPECT_EQ(record.size, static_cast<int>(next++));
+	});
+	EXPECT_EQ(count, records);
+	EXPECT_LT(producedAtFirst, source.produced() / 100);
+}
+
+TEST(Streaming, Errors) {
+	std::istringstream       is{"- {name: a, size: 1}\n- {name: b, size: -1}\n- {name: c, size: 3}\n"};
+	std::vector<std::string> names;
+	try {
+		streamSequence<DumpRecord>(is, [&](DumpRecord&& record) { names.push_back(record.name); });
+		FAIL() << "Negative size accepted";
+	} catch (const ValidatorFailed& e) {
+		EXPECT_EQ(e.yamlMark().line, 1);
+	}
+	EXPECT_EQ(names, std::vector<std::string>{"a"});
+
+	std::istringstream missing{"- {name: a, size: x}\n"};
+	try {
+		streamSequence<DumpRecord>(missing, [](DumpRecord&&) {});
+		FAIL() << "Invalid size accepted";
+	} catch (const InvalidValue<int>& e) {
+		EXPECT_NE(std::string{e.what()}.find("[0]/size"), std::string::npos) << e.what();
+	}
+
+	const auto ignore = [](int) {};
+
+	std::istringstream map{"a: 1"};
+	EXPECT_THROW(streamSequence<int>(map, ignore), InvalidNodeType);
+	std::istringstream empty{""};
+	EXPECT_THROW(streamSequence<int>(empty, ignore), MissingNode);
+}
+
+TEST(Streaming, Documents) {
+	std::istringstream       is{"name: a\nsize: 1\n---\nname: b\nsize: 2\n---\nname: c\nsize: 3\ntags: [x]\n"};
+	std::vector<std::string> names;
+	EXPECT_EQ(forEach<DumpRecord>(is, [&](DumpRecord&& record) { names.push_back(record.name); }), 3);
+	EXPECT_EQ(names, (std::vector<std::string>{"a", "b", "c"}));
+
+	std::istringstream invalid{"name: a\nsize: 1\n---\nname: b\nsize: x\n"};
+	try {
+		forEach<DumpRecord>(invalid, [](DumpRecord&&) {});
+		FAIL() << "Invalid size accepted";
+	} catch (const InvalidValue<int>& e) {
+		EXPECT_NE(std::string{e.what()}.find("[1]/size"), std::string::npos) << e.what();
+	}
+
+	std::istringstream            sequences{"[1, 2]\n---\n[3]\n"};
+	std::vector<std::vector<int>> documents;
+	EXPECT_EQ(forEach<std::vector<int>>(sequences, [&](std::vector<int>&& values) { documents.push_back(std::move(values)); }), 2);
+	EXPECT_EQ(documents, (std::vector<std::vector<int>>{{1, 2}, {3}}));
+
+	std::istringstream empty{""};
+	EXPECT_EQ(forEach<int>(empty, [](int) {}), 0);
+}
@@ -0,0 +1,91 @@
+#include "simple-yaml/simple_yaml.hpp"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace simple_yaml;
+
+struct Shard : Simple {
+	using Simple::Simple;
+
+	std::string      name     = bound("name");
+	std::vector<int> replicas = bound("replicas");
+};
+
+static bool slowRule(const std::string& region) {
+	std::this_thread::sleep_for(std::chrono::milliseconds{2});
+	return !region.empty();
+}
+
+struct Topology : Simple {
+	using Simple::Simple;
+
+	std::string        region = bound("region").addRule<std::string>(slowRule);
+	std::vector<Shard> shards = bound("shards");
+};
+
+struct Recorder : Tracer {
+	struct Entry {
+		std::string              path;
+		std::string              type;
+		std::chrono::nanoseconds elapsed;
+		std::chrono::nanoseconds validation;
+		std::size_t              scalars;
+	};
+
+	void field(const FieldTrace& trace) override {
+		entries.push_back({trace.path, std::string{trace.type}, trace.elapsed, trace.validation, trace.scalars});
+	}
+
+	const Entry& at(const std::string& path) const {
+		for (const auto& entry : entries) {
+			if (entry.path == path) {
+				return entry;
+			}
+		}
+		throw std::out_of_range(path);
+	}
+
+	std::vector<Entry> entries;
+};
+
+static const std::string source{R"(
+region: eu
+shards:
+  - {name: a, replicas: [1, 2, 3]}
+  - {name: b, replicas: [4]}
+)"};
+
+TEST(Trace, Fields) {
+	Recorder recorder;
+	{
+		const Tracer::Scope scope{recorder};
+		const Topology      topology{fromString(source)};
+		EXPECT_EQ(topology.shards.size(), 2);
+	}
+
+	std::vector<std::string> paths;
+	for (const auto& entry : recorder.entries) {
+		paths.push_back(entry.path);
+	}
+	// nested fields are reported first
+	EXPECT_EQ(paths, (std::vector<std::string>{"/region", "/shards[0]/name", "/shards[0]/replicas", "/shards[1]/name", "/shards[1]/replicas", "/shards"}));
+
+	const auto& region = recorder.at("/region");
+	EXPECT_EQ(region.scalars, 1);
+	EXPECT_GE(region.validation, std::chrono::milliseconds{2});
+	EXPECT_GE(region.elapsed, region.validation);
+
+	const auto& shards = recorder.at("/shards");
+	EXPECT_EQ(shards.scalars, 6);
+	EXPECT_EQ(shards.validation, std::chrono::nanoseconds{0});
+	EXPECT_GE(shards.elapsed, recorder.at("/shards[0]/replicas").elapsed);
+	EXPECT_NE(shards.type.find("Shard"), std::string::npos) << shards.type;
+	EXPECT_NE(recorder.at("/shards[0]/replicas").type.find("vector"), std::string::npos);
+
+	// nothing is reported outside of the scope
+	const Topology again{fromString(source)};
+	EXPECT_EQ(recorder.entries.size(), paths.size());
+}